@@ -30,8 +30,8 @@
 #include <private/xyanimation_p.h>
 #include <private/xychart_p.h>
 #include <QtCore/QDebug>
-
-Q_DECLARE_METATYPE(QVector<QPointF>)
+#include <QtCore/QtMath>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -97,51 +97,62 @@ void XYAnimation::setup(const QVector<QPointF> &oldPoints, const QVector<QPointF
     else if (m_type == NewAnimation)
         m_type = ReplacePointAnimation;
 
-    setKeyValueAt(0.0, qVariantFromValue(m_oldPoints));
-    setKeyValueAt(1.0, qVariantFromValue(m_newPoints));
+    // Only the progress is animated. The points are interpolated in updateCurrentValue().
+    setKeyValueAt(0.0, qreal(0.0));
+    setKeyValueAt(1.0, qreal(1.0));
 }
 
 QVariant XYAnimation::interpolated(const QVariant &start, const QVariant &end, qreal progress) const
 {
-    QVector<QPointF> startVector = qvariant_cast<QVector<QPointF> >(start);
-    QVector<QPointF> endVector = qvariant_cast<QVector<QPointF> >(end);
-    QVector<QPointF> result;
+    Q_UNUSED(start)
+    Q_UNUSED(end)
+    return progress;
+}
 
+// Interpolates the points at progress into m_buffer. The buffer keeps its storage between frames,
+// so no memory is allocated once the item has released the points of the previous frame.
+void XYAnimation::interpolate(qreal progress)
+{
     switch (m_type) {
 
     case ReplacePointAnimation:
     case AddPointAnimation:
     case RemovePointAnimation: {
-        if (startVector.count() != endVector.count())
+        if (m_oldPoints.count() != m_newPoints.count()) {
+            m_buffer.resize(0);
             break;
-
-        for (int i = 0; i < startVector.count(); i++) {
-            qreal x = startVector[i].x() + ((endVector[i].x() - startVector[i].x()) * progress);
-            qreal y = startVector[i].y() + ((endVector[i].y() - startVector[i].y()) * progress);
-            result << QPointF(x, y);
         }
 
+        m_buffer.resize(m_newPoints.count());
+        const QPointF *start = m_oldPoints.constData();
+        const QPointF *end = m_newPoints.constData();
+        QPointF *result = m_buffer.data();
+        for (int i = 0; i < m_newPoints.count(); i++) {
+            result[i] = QPointF(start[i].x() + ((end[i].x() - start[i].x()) * progress),
+                                start[i].y() + ((end[i].y() - start[i].y()) * progress));
+        }
     }
     break;
     case NewAnimation: {
-        for (int i = 0; i < endVector.count() * qBound(qreal(0), progress, qreal(1)); i++)
-            result << endVector[i];
+        const int count = qCeil(m_newPoints.count() * qBound(qreal(0), progress, qreal(1)));
+        m_buffer.resize(count);
+        std::copy(m_newPoints.constBegin(), m_newPoints.constBegin() + count, m_buffer.begin());
     }
     break;
     default:
         qWarning() << "Unknown type of animation";
         break;
     }
-
-    return qVariantFromValue(result);
 }
 
 void XYAnimation::updateCurrentValue(const QVariant &value)
 {
     if (state() != QAbstractAnimation::Stopped) { //workaround
 
-        QVector<QPointF> vector = qvariant_cast<QVector<QPointF> >(value);
-        m_item->setGeometryPoints(vector);
+        interpolate(value.toReal());
+        // The item releases the points of the previous frame in updateGeometry(), which leaves
+        // them to be overwritten by the next frame.
+        m_item->swapGeometryPoints(m_buffer);
         m_item->updateGeometry();
         m_item->setDirty(true);
         m_dirty = false;
@@ -62,6 +62,7 @@ protected:
     void updateCurrentValue(const QVariant &value);
     void updateState(QAbstractAnimation::State newState, QAbstractAnimation::State oldState);
     XYChart *chartItem() { return m_item; }
+    void interpolate(qreal progress);
 protected:
     Animation m_type;
     bool m_dirty;
@@ -70,6 +71,8 @@ private:
     XYChart *m_item;
     QVector<QPointF> m_oldPoints;
     QVector<QPointF> m_newPoints;
+    // The interpolated points, swapped with the geometry points of the item on every frame.
+    QVector<QPointF> m_buffer;
 };
 
 QT_CHARTS_END_NAMESPACE
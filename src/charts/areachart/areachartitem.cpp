@@ -37,6 +37,7 @@
 #include <QtGui/QPainter>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 #include <QtCore/QDebug>
+#include <algorithm>
 
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -46,6 +47,8 @@ AreaChartItem::AreaChartItem(QAreaSeries *areaSeries, QGraphicsItem* item)
       m_series(areaSeries),
       m_upper(0),
       m_lower(0),
+      m_upperCount(-1),
+      m_pathDirty(false),
       m_pointsVisible(false),
       m_pointLabelsVisible(false),
       m_pointLabelsFormat(areaSeries->pointLabelsFormat()),
@@ -137,52 +140,112 @@ QRectF AreaChartItem::boundingRect() const
 
 QPainterPath AreaChartItem::shape() const
 {
+    if (m_pathDirty) {
+        m_path = QPainterPath();
+        m_path.addPolygon(m_polygon);
+        m_path.closeSubpath();
+        m_pathDirty = false;
+    }
     return m_path;
 }
 
-void AreaChartItem::updatePath()
+// Updates the outline of the area after changedEdge has changed, or after both edges have changed
+// if changedEdge is null.
+// On cartesian charts the outline is a polygon of the upper line points followed by the lower line
+// points in reverse order, or by the two baseline corners if there is no lower series. The part of
+// the polygon that belongs to an edge that has not changed is kept as it is.
+void AreaChartItem::updatePath(LineChartItem *changedEdge)
 {
-    QPainterPath path;
-    QRectF rect(QPointF(0,0),domain()->size());
+    if (!m_upper) {
+        m_polygon.clear();
+        m_upperCount = -1;
+        setOutlineRect(QRectF());
+        return;
+    }
 
-    if (m_upper) {
-        path = m_upper->path();
+    if (presenter()->chartType() == QChart::ChartTypePolar) {
+        updatePolarPath();
+        return;
+    }
 
+    const QVector<QPointF> &upperPoints = m_upper->linePoints();
+    const bool upperResized = m_upperCount != upperPoints.size();
+    // Without a lower series the baseline corners depend on the upper points.
+    const bool updateUpper = !changedEdge || changedEdge == m_upper || upperResized;
+    const bool updateLower = !changedEdge || changedEdge == m_lower || upperResized || !m_lower;
+
+    if (updateUpper) {
+        if (upperResized) {
+            // Drops the lower part as well, it is appended again below.
+            m_polygon.resize(upperPoints.size());
+            m_upperCount = upperPoints.size();
+        }
+        std::copy(upperPoints.constBegin(), upperPoints.constEnd(), m_polygon.begin());
+        m_upperRect = QPolygonF(upperPoints).boundingRect();
+    }
+
+    if (updateLower) {
+        m_polygon.resize(m_upperCount);
         if (m_lower) {
-            // Note: Polarcharts draw area correctly only when both series have equal width or are
-            // fully displayed. If one series is partally off-chart, the connecting line between
-            // the series does not attach to the end of the partially hidden series but to the point
-            // where it intersects the axis line. The problem is especially noticeable when one of
-            // the series is entirely off-chart, in which case the connecting line connects two
-            // ends of the visible series.
-            // This happens because we get the paths from linechart, which omits off-chart segments.
-            // To properly fix, linechart would need to provide true full path, in right, left,
-            // and the rest portions to enable proper clipping. However, combining those to single
-            // visually unified area would be a nightmare, since they would have to be painted
-            // separately.
-            path.connectPath(m_lower->path().toReversed());
+            const QVector<QPointF> &lowerPoints = m_lower->linePoints();
+            m_polygon.reserve(m_upperCount + lowerPoints.size());
+            for (int i = lowerPoints.size() - 1; i >= 0; i--)
+                m_polygon.append(lowerPoints.at(i));
+            m_lowerRect = QPolygonF(lowerPoints).boundingRect();
+        } else if (m_upperCount > 0) {
+            const qreal bottom = domain()->size().height();
+            const QPointF last(upperPoints.last().x(), bottom);
+            const QPointF first(upperPoints.first().x(), bottom);
+            m_polygon.append(last);
+            m_polygon.append(first);
+            m_lowerRect = QRectF(first, last).normalized();
         } else {
-            QPointF first = path.pointAtPercent(0);
-            QPointF last =  path.pointAtPercent(1);
-            if (presenter()->chartType() == QChart::ChartTypeCartesian) {
-                path.lineTo(last.x(), rect.bottom());
-                path.lineTo(first.x(), rect.bottom());
-            } else { // polar
-                path.lineTo(rect.center());
-            }
+            m_lowerRect = QRectF();
         }
-        path.closeSubpath();
     }
 
-    // Only zoom in if the bounding rect of the path fits inside int limits. QWidget::update() uses
-    // a region that has to be compatible with QRect.
-    if (path.boundingRect().height() <= INT_MAX
-            && path.boundingRect().width() <= INT_MAX) {
+    m_pathDirty = true;
+    setOutlineRect(m_upperRect.united(m_lowerRect));
+}
+
+void AreaChartItem::updatePolarPath()
+{
+    QPainterPath path = m_upper->path();
+
+    if (m_lower) {
+        // Note: Polarcharts draw area correctly only when both series have equal width or are
+        // fully displayed. If one series is partally off-chart, the connecting line between
+        // the series does not attach to the end of the partially hidden series but to the point
+        // where it intersects the axis line. The problem is especially noticeable when one of
+        // the series is entirely off-chart, in which case the connecting line connects two
+        // ends of the visible series.
+        // This happens because we get the paths from linechart, which omits off-chart segments.
+        // To properly fix, linechart would need to provide true full path, in right, left,
+        // and the rest portions to enable proper clipping. However, combining those to single
+        // visually unified area would be a nightmare, since they would have to be painted
+        // separately.
+        path.connectPath(m_lower->path().toReversed());
+    } else {
+        path.lineTo(QRectF(QPointF(0, 0), domain()->size()).center());
+    }
+    path.closeSubpath();
+
+    m_polygon.clear();
+    m_upperCount = -1;
+    m_path = path;
+    m_pathDirty = false;
+    setOutlineRect(path.boundingRect());
+}
+
+void AreaChartItem::setOutlineRect(const QRectF &rect)
+{
+    // Only zoom in if the bounding rect of the outline fits inside int limits. QWidget::update()
+    // uses a region that has to be compatible with QRect.
+    if (rect.height() <= INT_MAX && rect.width() <= INT_MAX) {
         prepareGeometryChange();
-        m_path = path;
-        m_rect = path.boundingRect();
-        update();
+        m_rect = rect;
     }
+    update();
 }
 
 void AreaChartItem::handleUpdated()
@@ -241,7 +304,10 @@ void AreaChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
     else
         painter->setClipRect(clipRect);
 
-    painter->drawPath(m_path);
+    if (presenter()->chartType() == QChart::ChartTypePolar)
+        painter->drawPath(m_path);
+    else
+        painter->drawPolygon(m_polygon);
     if (m_pointsVisible) {
         painter->setPen(m_pointPen);
         if (m_upper)
@@ -268,16 +334,19 @@ void AreaChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
         QString pointLabel;
 
         if (m_series->upperSeries()) {
-            for (int i(0); i < m_series->upperSeries()->count(); i++) {
+            // Culled edge lines only have geometry points for the points in view.
+            const QVector<QPointF> points = m_upper->geometryPoints();
+            const int offset = m_upper->geometryPointsOffset();
+            const int count = qMin(points.size(), m_series->upperSeries()->count() - offset);
+            for (int i(0); i < count; i++) {
+                const QPointF &seriesPoint = m_series->upperSeries()->at(offset + i);
                 pointLabel = m_pointLabelsFormat;
-                pointLabel.replace(xPointTag,
-                                   presenter()->numberToString(m_series->upperSeries()->at(i).x()));
-                pointLabel.replace(yPointTag,
-                                   presenter()->numberToString(m_series->upperSeries()->at(i).y()));
+                pointLabel.replace(xPointTag, presenter()->numberToString(seriesPoint.x()));
+                pointLabel.replace(yPointTag, presenter()->numberToString(seriesPoint.y()));
 
                 // Position text in relation to the point
                 int pointLabelWidth = fm.width(pointLabel);
-                QPointF position(m_upper->geometryPoints().at(i));
+                QPointF position(points.at(i));
                 position.setX(position.x() - pointLabelWidth / 2);
                 position.setY(position.y() - m_series->upperSeries()->pen().width() / 2
                               - labelOffset);
@@ -286,16 +355,18 @@ void AreaChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
         }
 
         if (m_series->lowerSeries()) {
-            for (int i(0); i < m_series->lowerSeries()->count(); i++) {
+            const QVector<QPointF> points = m_lower->geometryPoints();
+            const int offset = m_lower->geometryPointsOffset();
+            const int count = qMin(points.size(), m_series->lowerSeries()->count() - offset);
+            for (int i(0); i < count; i++) {
+                const QPointF &seriesPoint = m_series->lowerSeries()->at(offset + i);
                 pointLabel = m_pointLabelsFormat;
-                pointLabel.replace(xPointTag,
-                                   presenter()->numberToString(m_series->lowerSeries()->at(i).x()));
-                pointLabel.replace(yPointTag,
-                                   presenter()->numberToString(m_series->lowerSeries()->at(i).y()));
+                pointLabel.replace(xPointTag, presenter()->numberToString(seriesPoint.x()));
+                pointLabel.replace(yPointTag, presenter()->numberToString(seriesPoint.y()));
 
                 // Position text in relation to the point
                 int pointLabelWidth = fm.width(pointLabel);
-                QPointF position(m_lower->geometryPoints().at(i));
+                QPointF position(points.at(i));
                 position.setX(position.x() - pointLabelWidth / 2);
                 position.setY(position.y() - m_series->lowerSeries()->pen().width() / 2
                               - labelOffset);
@@ -44,6 +44,7 @@
 #include <QtCharts/private/qchartglobal_p.h>
 #include <QtCharts/QAreaSeries>
 #include <QtGui/QPen>
+#include <QtGui/QPolygonF>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -64,7 +65,7 @@ public:
     LineChartItem *upperLineItem() const { return m_upper; }
     LineChartItem *lowerLineItem() const { return m_lower; }
 
-    void updatePath();
+    void updatePath(LineChartItem *changedEdge = 0);
 
     void setPresenter(ChartPresenter *presenter);
     QAreaSeries *series() const { return m_series; }
@@ -92,11 +93,20 @@ public Q_SLOTS:
 
 private:
     void fixEdgeSeriesDomain(LineChartItem *edgeSeries);
+    void updatePolarPath();
+    void setOutlineRect(const QRectF &rect);
 
     QAreaSeries *m_series;
     LineChartItem *m_upper;
     LineChartItem *m_lower;
-    QPainterPath m_path;
+    // On cartesian charts the outline is kept in m_polygon, and m_path is only created from it
+    // for hit testing. Polar outlines are built from the edge paths.
+    QPolygonF m_polygon;
+    int m_upperCount;
+    QRectF m_upperRect;
+    QRectF m_lowerRect;
+    mutable QPainterPath m_path;
+    mutable bool m_pathDirty;
     QRectF m_rect;
     QPen m_linePen;
     QPen m_pointPen;
@@ -137,10 +147,17 @@ public:
             // so get the chart type for them from area chart.
             forceChartType(m_item->series()->chart()->chartType());
             LineChartItem::updateGeometry();
-            m_item->updatePath();
+            m_item->updatePath(this);
         }
     }
 
+    void extendGeometry(int first)
+    {
+        // The area path is always rebuilt from the complete edge lines.
+        Q_UNUSED(first)
+        updateGeometry();
+    }
+
 private:
     AreaChartItem *m_item;
 };
@@ -29,6 +29,7 @@
 
 #include <QtCharts/QAreaSeries>
 #include <private/qareaseries_p.h>
+#include <private/qxyseries_p.h>
 #include <QtCharts/QLineSeries>
 #include <private/areachartitem_p.h>
 #include <private/abstractdomain_p.h>
@@ -695,18 +696,21 @@ void QAreaSeriesPrivate::initializeDomain()
     QLineSeries *upperSeries = q->upperSeries();
     QLineSeries *lowerSeries = q->lowerSeries();
 
+    // The edges are read through their private data, so that series stored in columns are not
+    // converted to points.
     if (upperSeries) {
-        const QVector<QPointF> &points = upperSeries->pointsVector();
+        const QXYSeriesPrivate *upper = static_cast<const QXYSeries *>(upperSeries)->d_func();
 
-        if (!points.isEmpty()) {
-            minX = points[0].x();
-            minY = points[0].y();
+        if (upper->count() > 0) {
+            minX = upper->pointAt(0).x();
+            minY = upper->pointAt(0).y();
             maxX = minX;
             maxY = minY;
 
-            for (int i = 0; i < points.count(); i++) {
-                qreal x = points[i].x();
-                qreal y = points[i].y();
+            for (int i = 0; i < upper->count(); i++) {
+                const QPointF point = upper->pointAt(i);
+                qreal x = point.x();
+                qreal y = point.y();
                 minX = qMin(minX, x);
                 minY = qMin(minY, y);
                 maxX = qMax(maxX, x);
@@ -715,19 +719,20 @@ void QAreaSeriesPrivate::initializeDomain()
         }
     }
     if (lowerSeries) {
-        const QVector<QPointF> &points = lowerSeries->pointsVector();
+        const QXYSeriesPrivate *lower = static_cast<const QXYSeries *>(lowerSeries)->d_func();
 
-        if (!points.isEmpty()) {
+        if (lower->count() > 0) {
             if (!upperSeries) {
-                minX = points[0].x();
-                minY = points[0].y();
+                minX = lower->pointAt(0).x();
+                minY = lower->pointAt(0).y();
                 maxX = minX;
                 maxY = minY;
             }
 
-            for (int i = 0; i < points.count(); i++) {
-                qreal x = points[i].x();
-                qreal y = points[i].y();
+            for (int i = 0; i < lower->count(); i++) {
+                const QPointF point = lower->pointAt(i);
+                qreal x = point.x();
+                qreal y = point.y();
                 minX = qMin(minX, x);
                 minY = qMin(minY, y);
                 maxX = qMax(maxX, x);
@@ -41,9 +41,16 @@
 #include <QtCore/QtMath>
 #include <QtGui/QPainter>
 #include <QtGui/QTextDocument>
+#include <QtWidgets/QGraphicsSceneEvent>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+namespace {
+// Above this many visible bars without labels the bars are painted from the layout
+// instead of having a graphics item each.
+const int batchedBarThreshold = 1000;
+}
+
 AbstractBarChartItem::AbstractBarChartItem(QAbstractBarSeries *series, QGraphicsItem* item) :
     ChartItem(series->d_func(),item),
     m_animation(0),
@@ -53,7 +60,12 @@ AbstractBarChartItem::AbstractBarChartItem(QAbstractBarSeries *series, QGraphics
     m_categoryCount(0),
     m_labelItemsMissing(false),
     m_orientation(Qt::Horizontal),
-    m_resetAnimation(true)
+    m_resetAnimation(true),
+    m_batched(false),
+    m_hoveredSet(0),
+    m_hoveredCategory(-1),
+    m_pressedSet(0),
+    m_pressedCategory(-1)
 {
     setAcceptedMouseButtons(0);
     setFlag(ItemClipsChildrenToShape);
@@ -94,9 +106,35 @@ AbstractBarChartItem::~AbstractBarChartItem()
 
 void AbstractBarChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    Q_UNUSED(painter);
     Q_UNUSED(option);
     Q_UNUSED(widget);
+
+    const int setCount = m_series->count();
+    if (!m_batched || !m_series->isVisible() || m_layout.size() != setCount * m_categoryCount)
+        return;
+
+    painter->save();
+    painter->setClipRect(m_rect);
+    painter->setOpacity(painter->opacity() * m_series->opacity());
+
+    QVector<QRectF> rects;
+    rects.reserve(m_categoryCount);
+    for (int set = 0; set < setCount; set++) {
+        const QBarSetPrivate *barSetP = m_series->d_func()->barsetAt(set)->d_ptr.data();
+        rects.clear();
+        const int first = set * m_categoryCount;
+        for (int i = first; i < first + m_categoryCount; i++) {
+            // Empty bars are hidden like the bar items are
+            const QRectF &rect = m_layout.at(i);
+            if (!rect.isEmpty())
+                rects.append(rect);
+        }
+        painter->setPen(barSetP->m_pen);
+        painter->setBrush(barSetP->m_brush);
+        painter->drawRects(rects);
+    }
+
+    painter->restore();
 }
 
 QRectF AbstractBarChartItem::boundingRect() const
@@ -104,19 +142,29 @@ QRectF AbstractBarChartItem::boundingRect() const
     return m_rect;
 }
 
+bool AbstractBarChartItem::contains(const QPointF &point) const
+{
+    // In the batched mode only the bars are part of the item, so that mouse events on the empty
+    // plot area are delivered to the items below.
+    if (m_batched) {
+        int set;
+        int category;
+        return barAt(point, set, category);
+    }
+    return ChartItem::contains(point);
+}
+
 void AbstractBarChartItem::initializeFullLayout()
 {
     qreal setCount = m_series->count();
 
     for (int set = 0; set < setCount; set++) {
-        QBarSet *barSet = m_series->barSets().at(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < bars.size(); i++) {
-            Bar *bar = bars.at(i);
-            initializeLayout(set, bar->index(), bar->layoutIndex(), true);
-            // Make bar initially hidden to avoid artifacts, layout setting will show it
-            bar->setVisible(false);
-        }
+        for (int category = m_firstCategory; category <= m_lastCategory; category++)
+            initializeLayout(set, category, barLayoutIndex(set, category), true);
+        // Make bars initially hidden to avoid artifacts, layout setting will show them
+        const QList<Bar *> bars = m_barMap.value(m_series->barSets().at(set));
+        for (int i = 0; i < bars.size(); i++)
+            bars.at(i)->setVisible(false);
     }
 }
 
@@ -160,6 +208,11 @@ void AbstractBarChartItem::setLayout(const QVector<QRectF> &layout)
 
     m_layout = layout;
 
+    if (m_batched) {
+        update();
+        return;
+    }
+
     const bool visible = m_series->isVisible();
     for (int set = 0; set < setCount; set++) {
         QBarSet *barSet = m_series->d_func()->barsetAt(set);
@@ -206,6 +259,10 @@ void AbstractBarChartItem::handleLayoutChanged()
 
 void AbstractBarChartItem::handleLabelsVisibleChanged(bool visible)
 {
+    // Labels need the bar items, and hiding the labels of many bars allows dropping the items
+    if (visible ? m_batched : (!m_batched && m_layout.size() > batchedBarThreshold))
+        handleLayoutChanged();
+
     bool newVisible = visible && m_series->isVisible();
     QMapIterator<QBarSet *, QList<Bar *> > i(m_barMap);
     while (i.hasNext()) {
@@ -244,12 +301,16 @@ void AbstractBarChartItem::handleVisibleChanged()
             bar->setVisible(visible && i.key()->at(bar->index()) != 0.0);
         }
     }
+    if (m_batched)
+        update();
 }
 
 void AbstractBarChartItem::handleOpacityChanged()
 {
     foreach (QGraphicsItem *item, childItems())
         item->setOpacity(m_series->opacity());
+    if (m_batched)
+        update();
 }
 
 void AbstractBarChartItem::handleUpdatedBars()
@@ -306,6 +367,8 @@ void AbstractBarChartItem::handleUpdatedBars()
                 }
             }
         }
+        if (m_batched)
+            update();
     }
 }
 
@@ -530,6 +593,10 @@ void AbstractBarChartItem::handleSetStructureChange()
     // Remove obsolete sets
     for (int i = 0; i < oldSets.size(); i++) {
         if (!newSets.contains(oldSets.at(i))) {
+            if (m_hoveredSet == oldSets.at(i))
+                m_hoveredSet = 0;
+            if (m_pressedSet == oldSets.at(i))
+                m_pressedSet = 0;
             qDeleteAll(m_barMap.value(oldSets.at(i)));
             m_barMap.remove(oldSets.at(i));
         }
@@ -570,6 +637,8 @@ QString AbstractBarChartItem::generateLabelText(int set, int category, qreal val
 
 void AbstractBarChartItem::updateBarItems()
 {
+    const int oldFirstCategory = m_firstCategory;
+    const int oldCategoryCount = m_categoryCount;
     int min(0);
     int max(0);
     if (m_orientation == Qt::Vertical) {
@@ -601,9 +670,18 @@ void AbstractBarChartItem::updateBarItems()
 
     int layoutSize = m_categoryCount * newSets.size();
 
+    const bool batched = !m_series->isLabelsVisible() && layoutSize > batchedBarThreshold;
+    if (batched != m_batched)
+        setBatched(batched);
+    if (m_batched) {
+        updateBatchedLayout(oldFirstCategory, oldCategoryCount);
+        return;
+    }
+
     QVector<QRectF> oldLayout = m_layout;
     if (layoutSize != m_layout.size())
         m_layout.resize(layoutSize);
+    m_layoutIndexes.resize(layoutSize);
 
     // Create new graphic items for bars or remove excess ones
     int layoutIndex = 0;
@@ -669,6 +747,8 @@ void AbstractBarChartItem::updateBarItems()
         }
 
         m_indexForBarMap.insert(set, indexMap);
+        for (int c = m_firstCategory; c <= m_lastCategory; c++)
+            m_layoutIndexes[s * m_categoryCount + c - m_firstCategory] = indexMap.value(c)->layoutIndex();
 
         if (m_animation) {
             for (int i = 0; i < unassignedIndex; i++) {
@@ -726,6 +806,166 @@ void AbstractBarChartItem::calculateSeriesPositionAdjustmentAndWidth()
     }
 }
 
+void AbstractBarChartItem::setBatched(bool batched)
+{
+    m_batched = batched;
+    if (batched) {
+        QMap<QBarSet *, QList<Bar *> >::iterator i = m_barMap.begin();
+        for (; i != m_barMap.end(); ++i) {
+            qDeleteAll(i.value());
+            i.value().clear();
+        }
+        m_indexForBarMap.clear();
+        m_layoutIndexes.clear();
+    } else {
+        endBatchedHover();
+        m_pressedSet = 0;
+    }
+    // The layout order differs between the modes
+    m_layout.clear();
+
+    setAcceptedMouseButtons(batched ? Qt::MouseButtons(Qt::LeftButton | Qt::RightButton)
+                                    : Qt::MouseButtons(Qt::NoButton));
+    setAcceptHoverEvents(batched);
+    update();
+}
+
+void AbstractBarChartItem::updateBatchedLayout(int oldFirstCategory, int oldCategoryCount)
+{
+    const int setCount = m_series->count();
+    const int oldLastCategory = oldFirstCategory + oldCategoryCount - 1;
+    const bool reuse = oldCategoryCount > 0 && m_layout.size() == setCount * oldCategoryCount;
+
+    // Keep the bars of the categories that stay visible, so that animations continue from them
+    QVector<QRectF> layout(setCount * m_categoryCount);
+    if (reuse) {
+        const int first = qMax(m_firstCategory, oldFirstCategory);
+        const int last = qMin(m_lastCategory, oldLastCategory);
+        for (int set = 0; set < setCount; set++) {
+            for (int category = first; category <= last; category++) {
+                layout[set * m_categoryCount + category - m_firstCategory]
+                        = m_layout.at(set * oldCategoryCount + category - oldFirstCategory);
+            }
+        }
+    }
+    m_layout.swap(layout);
+
+    if (m_animation) {
+        for (int set = 0; set < setCount; set++) {
+            for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+                if (!reuse || category < oldFirstCategory || category > oldLastCategory)
+                    initializeLayout(set, category, barLayoutIndex(set, category), m_resetAnimation);
+            }
+        }
+    }
+}
+
+// Finds the topmost batched bar at the item position
+bool AbstractBarChartItem::barAt(const QPointF &pos, int &set, int &category) const
+{
+    if (!m_batched || !m_series->isVisible() || !m_rect.contains(pos)
+            || m_layout.size() != m_series->count() * m_categoryCount) {
+        return false;
+    }
+
+    // Bars of a category are centered on the category value, so only one category can be hit
+    const QPointF value = domain()->calculateDomainPoint(pos);
+    category = qRound((m_orientation == Qt::Vertical ? value.x() : value.y())
+                      - m_seriesPosAdjustment);
+    if (category < m_firstCategory || category > m_lastCategory)
+        return false;
+
+    for (set = m_series->count() - 1; set >= 0; set--) {
+        const QRectF &rect = m_layout.at(barLayoutIndex(set, category));
+        if (!rect.isEmpty() && rect.contains(pos))
+            return true;
+    }
+    return false;
+}
+
+void AbstractBarChartItem::endBatchedHover()
+{
+    QBarSet *barSet = m_hoveredSet;
+    m_hoveredSet = 0;
+    if (barSet) {
+        emit m_series->hovered(false, m_hoveredCategory, barSet);
+        emit barSet->hovered(false, m_hoveredCategory);
+    }
+}
+
+void AbstractBarChartItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+    int set;
+    int category;
+    if (!barAt(event->pos(), set, category)) {
+        event->ignore();
+        return;
+    }
+    m_pressedSet = m_series->d_func()->barsetAt(set);
+    m_pressedCategory = category;
+    emit m_series->pressed(category, m_pressedSet);
+    emit m_pressedSet->pressed(category);
+}
+
+void AbstractBarChartItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
+{
+    Q_UNUSED(event)
+
+    // As with the bar items, the pressed bar gets the release wherever it happens
+    QBarSet *barSet = m_pressedSet;
+    m_pressedSet = 0;
+    if (barSet) {
+        emit m_series->released(m_pressedCategory, barSet);
+        emit barSet->released(m_pressedCategory);
+        emit m_series->clicked(m_pressedCategory, barSet);
+        emit barSet->clicked(m_pressedCategory);
+    }
+}
+
+void AbstractBarChartItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
+{
+    int set;
+    int category;
+    if (!barAt(event->pos(), set, category)) {
+        event->ignore();
+        return;
+    }
+    QBarSet *barSet = m_series->d_func()->barsetAt(set);
+    emit m_series->doubleClicked(category, barSet);
+    emit barSet->doubleClicked(category);
+    QGraphicsItem::mouseDoubleClickEvent(event);
+}
+
+void AbstractBarChartItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
+{
+    hoverMoveEvent(event);
+}
+
+void AbstractBarChartItem::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
+{
+    int set;
+    int category;
+    QBarSet *barSet = 0;
+    if (barAt(event->pos(), set, category))
+        barSet = m_series->d_func()->barsetAt(set);
+    if (barSet == m_hoveredSet && (!barSet || category == m_hoveredCategory))
+        return;
+
+    endBatchedHover();
+    if (barSet) {
+        m_hoveredSet = barSet;
+        m_hoveredCategory = category;
+        emit m_series->hovered(true, category, barSet);
+        emit barSet->hovered(true, category);
+    }
+}
+
+void AbstractBarChartItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+    Q_UNUSED(event)
+    endBatchedHover();
+}
+
 #include "moc_abstractbarchartitem_p.cpp"
 
 QT_CHARTS_END_NAMESPACE
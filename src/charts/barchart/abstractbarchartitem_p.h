@@ -65,6 +65,7 @@ public:
 public:
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
     QRectF boundingRect() const;
+    bool contains(const QPointF &point) const;
 
     virtual QVector<QRectF> calculateLayout() = 0;
     void initializeFullLayout();
@@ -99,6 +100,24 @@ protected:
     void updateBarItems();
     virtual void markLabelsDirty(QBarSet *barset, int index, int count);
     void calculateSeriesPositionAdjustmentAndWidth();
+    void setBatched(bool batched);
+    void updateBatchedLayout(int oldFirstCategory, int oldCategoryCount);
+    bool barAt(const QPointF &pos, int &set, int &category) const;
+    void endBatchedHover();
+
+    void mousePressEvent(QGraphicsSceneMouseEvent *event);
+    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
+    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
+    void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
+    void hoverMoveEvent(QGraphicsSceneHoverEvent *event);
+    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
+
+    // Layout index of the bar of the set at the category, which must be visible.
+    int barLayoutIndex(int set, int category) const
+    {
+        const int slot = set * m_categoryCount + category - m_firstCategory;
+        return m_batched ? slot : m_layoutIndexes.at(slot);
+    }
 
     QRectF m_rect;
     QVector<QRectF> m_layout;
@@ -117,6 +136,14 @@ protected:
     bool m_resetAnimation;
     qreal m_seriesPosAdjustment;
     qreal m_seriesWidth;
+    // In the batched mode there are no Bar items, the item paints m_layout itself and
+    // the layout is ordered by set and category.
+    bool m_batched;
+    QVector<int> m_layoutIndexes;
+    QBarSet *m_hoveredSet;
+    int m_hoveredCategory;
+    QBarSet *m_pressedSet;
+    int m_pressedCategory;
 };
 
 QT_CHARTS_END_NAMESPACE
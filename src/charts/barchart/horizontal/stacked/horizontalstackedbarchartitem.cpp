@@ -58,17 +58,14 @@ void HorizontalStackedBarChartItem::initializeLayout(int set, int category,
             QBarSet *checkSet = m_series->barSets().at(checkIndex);
             const qreal checkValue = checkSet->at(category);
             if ((value < 0.0) == (checkValue < 0.0)) {
-                Bar *checkBar = m_indexForBarMap.value(checkSet).value(category);
-                rect = m_layout.at(checkBar->layoutIndex());
+                rect = m_layout.at(barLayoutIndex(checkIndex, category));
                 found = true;
                 break;
             }
         }
         // If we didn't find a previous set to the same direction, just stack next to the first set
         if (!found) {
-            QBarSet *firsSet = m_series->barSets().at(0);
-            Bar *firstBar = m_indexForBarMap.value(firsSet).value(category);
-            rect = m_layout.at(firstBar->layoutIndex());
+            rect = m_layout.at(barLayoutIndex(0, category));
         }
         if (value < 0)
             rect.setRight(rect.left());
@@ -121,10 +118,8 @@ QVector<QRectF> HorizontalStackedBarChartItem::calculateLayout()
 
     for (int set = 0; set < setCount; set++) {
         QBarSet *barSet = m_series->barSets().at(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < m_categoryCount; i++) {
-            Bar *bar = bars.at(i);
-            const int category = bar->index();
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const int layoutIndex = barLayoutIndex(set, category);
             qreal &positiveSum = positiveSums[category - m_firstCategory];
             qreal &negativeSum = negativeSums[category - m_firstCategory];
             qreal value = barSet->at(category);
@@ -157,17 +152,17 @@ QVector<QRectF> HorizontalStackedBarChartItem::calculateLayout()
             rect.setTopLeft(topLeft);
             rect.setBottomRight(bottomRight);
             rect = rect.normalized();
-            layout[bar->layoutIndex()] = rect;
+            layout[layoutIndex] = rect;
 
             // If animating, we need to reinitialize ~zero size bars with non-zero values
             // so the bar growth animation starts at correct spot. We shouldn't reset if rect
             // is already at correct position horizontally, so we check for that.
             if (m_animation && value != 0.0) {
-                const QRectF &checkRect = m_layout.at(bar->layoutIndex());
+                const QRectF &checkRect = m_layout.at(layoutIndex);
                 if (checkRect.isEmpty() &&
                         ((value < 0.0 && !qFuzzyCompare(checkRect.right(), rect.right()))
                          || (value > 0.0 && !qFuzzyCompare(checkRect.left(), rect.left())))) {
-                    initializeLayout(set, category, bar->layoutIndex(), true);
+                    initializeLayout(set, category, layoutIndex, true);
                 }
             }
         }
@@ -49,9 +49,7 @@ void BarChartItem::initializeLayout(int set, int category, int layoutIndex, bool
     QRectF rect;
 
     if (set > 0) {
-        QBarSet *barSet = m_series->barSets().at(set - 1);
-        Bar *bar = m_indexForBarMap.value(barSet).value(category);
-        rect = m_layout.at(bar->layoutIndex());
+        rect = m_layout.at(barLayoutIndex(set - 1, category));
         qreal oldRight = rect.right();
         if (resetAnimation)
             rect.setRight(oldRight + rect.width());
@@ -107,10 +105,8 @@ QVector<QRectF> BarChartItem::calculateLayout()
 
     for (int set = 0; set < setCount; set++) {
         QBarSet *barSet = m_series->barSets().at(set);
-        const QList<Bar *> bars = m_barMap.value(barSet);
-        for (int i = 0; i < m_categoryCount; i++) {
-            Bar *bar = bars.at(i);
-            const int category = bar->index();
+        for (int category = m_firstCategory; category <= m_lastCategory; category++) {
+            const int layoutIndex = barLayoutIndex(set, category);
             qreal value = barSet->at(category);
             QRectF rect;
             QPointF topLeft = topLeftPoint(set, setCount, category, barWidth, value);
@@ -124,7 +120,7 @@ QVector<QRectF> BarChartItem::calculateLayout()
 
             rect.setTopLeft(topLeft);
             rect.setBottomRight(bottomRight);
-            layout[bar->layoutIndex()] = rect.normalized();
+            layout[layoutIndex] = rect.normalized();
         }
     }
 
@@ -90,6 +90,8 @@ void BoxPlotChartItem::handleDataStructureChanged()
 {
     int setCount = m_series->count();
 
+    m_series->d_func()->updateStatistics();
+
     for (int s = 0; s < setCount; s++) {
         QBoxSet *set = m_series->d_func()->boxSetAt(s);
 
@@ -180,6 +182,8 @@ void BoxPlotChartItem::handleDomainUpdated()
 
 void BoxPlotChartItem::handleLayoutChanged()
 {
+    m_series->d_func()->updateStatistics();
+
     foreach (BoxWhiskers *item, m_boxTable.values()) {
         if (m_animation)
             m_animation->setAnimationStart(item);
@@ -40,9 +40,23 @@
 #include <private/qchart_p.h>
 #include <QtCharts/QBoxSet>
 #include <private/qboxset_p.h>
+#include <QtConcurrent/QtConcurrentMap>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+namespace {
+
+// Below this many pending samples in total, computing the statistics on the calling thread is
+// cheaper than dispatching the sets to the thread pool.
+const int parallelStatisticsThreshold = 100000;
+
+void updateSetStatistics(QBoxSetPrivate *&set)
+{
+    set->updateStatistics();
+}
+
+}
+
 /*!
     \class QBoxPlotSeries
     \inmodule Qt Charts
@@ -684,11 +698,34 @@ QBoxSet *QBoxPlotSeriesPrivate::boxSetAt(int index)
     return m_boxSets.at(index);
 }
 
+// Computes the pending sample statistics of all sets before their values are read. The sets
+// are independent, so for large sample counts they are processed concurrently.
+void QBoxPlotSeriesPrivate::updateStatistics()
+{
+    QVector<QBoxSetPrivate *> pending;
+    int sampleCount = 0;
+    foreach (QBoxSet *set, m_boxSets) {
+        if (set->d_ptr->hasPendingStatistics()) {
+            pending.append(set->d_ptr.data());
+            sampleCount += set->d_ptr->sampleCount();
+        }
+    }
+
+    if (pending.count() > 1 && sampleCount >= parallelStatisticsThreshold) {
+        QtConcurrent::blockingMap(pending, updateSetStatistics);
+    } else {
+        foreach (QBoxSetPrivate *set, pending)
+            set->updateStatistics();
+    }
+}
+
 qreal QBoxPlotSeriesPrivate::min()
 {
     if (m_boxSets.count() <= 0)
         return 0;
 
+    updateStatistics();
+
     qreal min = m_boxSets.at(0)->at(0);
 
     foreach (QBoxSet *set, m_boxSets) {
@@ -706,6 +743,8 @@ qreal QBoxPlotSeriesPrivate::max()
     if (m_boxSets.count() <= 0)
         return 0;
 
+    updateStatistics();
+
     qreal max = m_boxSets.at(0)->at(0);
 
     foreach (QBoxSet *set, m_boxSets) {
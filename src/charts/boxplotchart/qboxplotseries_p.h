@@ -74,6 +74,7 @@ public:
     bool remove(QList<QBoxSet *> sets);
     bool insert(int index, QBoxSet *set);
     QBoxSet *boxSetAt(int index);
+    void updateStatistics();
 
     qreal max();
     qreal min();
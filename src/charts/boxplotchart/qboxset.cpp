@@ -30,9 +30,23 @@
 #include <QtCharts/QBoxSet>
 #include <private/qboxset_p.h>
 #include <private/charthelpers_p.h>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+namespace {
+
+// Returns the median of the values in the sorted range.
+qreal sortedMedian(const qreal *begin, const qreal *end)
+{
+    const qreal *middle = begin + (end - begin) / 2;
+    if ((end - begin) % 2)
+        return *middle;
+    return (*(middle - 1) + *middle) / 2.0;
+}
+
+}
+
 /*!
     \class QBoxSet
     \inmodule Qt Charts
@@ -47,6 +61,14 @@ QT_CHARTS_BEGIN_NAMESPACE
     The second way is to create an empty QBoxSet instance and specify the values using the
     setValue() method.
 
+    Alternatively, the values can be computed from raw samples given with setSamples() and
+    appendSamples(). The extremes are then the smallest and largest sample, the median is the
+    median of all samples, and the quartiles are the medians of the lower and upper half of
+    the samples. The samples are kept sorted: the samples appended since the statistics were
+    last computed are sorted and merged into the others when the statistics are next needed,
+    after which the median and the quartiles are read from the sorted samples. For box plot
+    series with many samples, the sets are processed in parallel.
+
     See the \l{Box and Whiskers Example}{box-and-whiskers chart example} to learn how to
     create a box-and-whiskers chart.
 
@@ -182,6 +204,43 @@ void QBoxSet::append(const QList<qreal> &values)
         emit valuesChanged();
 }
 
+/*!
+    \since 5.11
+    Sets the values of the box-and-whiskers item to the statistics of \a samples, replacing
+    any previous samples and values. Samples that are not finite numbers are ignored.
+    \sa appendSamples(), sampleCount()
+*/
+void QBoxSet::setSamples(const QList<qreal> &samples)
+{
+    d_ptr->setSamples(samples);
+    emit valuesChanged();
+}
+
+/*!
+    \since 5.11
+    Adds \a samples to the raw samples of the box-and-whiskers item and updates its values.
+    The extremes are updated right away; the quartiles and the median are recomputed once
+    when they are next needed, no matter how many times samples were appended in between.
+    Samples that are not finite numbers are ignored.
+    \sa setSamples()
+*/
+void QBoxSet::appendSamples(const QList<qreal> &samples)
+{
+    if (d_ptr->appendSamples(samples))
+        emit valuesChanged();
+}
+
+/*!
+    \since 5.11
+    Returns the number of raw samples the values of the box-and-whiskers item are computed
+    from.
+    \sa setSamples()
+*/
+int QBoxSet::sampleCount() const
+{
+    return d_ptr->sampleCount();
+}
+
 /*!
     Sets the label specified by \a label for the category of the box-and-whiskers item.
 */
@@ -220,7 +279,7 @@ void QBoxSet::setValue(const int index, const qreal value)
 }
 
 /*!
-    Sets all the values of the box-and-whiskers item to 0.
+    Sets all the values of the box-and-whiskers item to 0 and removes its raw samples.
  */
 void QBoxSet::clear()
 {
@@ -237,6 +296,7 @@ qreal QBoxSet::at(const int index) const
 {
     if (index < 0 || index >= 5)
         return 0;
+    d_ptr->updateStatistics();
     return d_ptr->m_values[index];
 }
 
@@ -307,7 +367,9 @@ QBoxSetPrivate::QBoxSetPrivate(const QString label, QBoxSet *parent) : QObject(p
     m_appendCount(0),
     m_pen(QPen(Qt::NoPen)),
     m_brush(QBrush(Qt::NoBrush)),
-    m_series(0)
+    m_series(0),
+    m_sortedCount(0),
+    m_statisticsPending(false)
 {
     m_values = new qreal[m_valuesCount];
 }
@@ -347,6 +409,9 @@ bool QBoxSetPrivate::append(QList<qreal> values)
 
 void QBoxSetPrivate::clear()
 {
+    m_samples.clear();
+    m_sortedCount = 0;
+    m_statisticsPending = false;
     m_appendCount = 0;
     for (int i = 0; i < m_valuesCount; i++)
          m_values[i] = 0.0;
@@ -355,6 +420,8 @@ void QBoxSetPrivate::clear()
 
 void QBoxSetPrivate::setValue(const int index, const qreal value)
 {
+    // An explicit value overrides the one computed from the samples.
+    updateStatistics();
     if (index < m_valuesCount) {
         m_values[index] = value;
         emit updatedLayout();
@@ -365,9 +432,76 @@ qreal QBoxSetPrivate::value(const int index)
 {
     if (index < 0 || index >= m_valuesCount)
         return 0;
+    updateStatistics();
     return m_values[index];
 }
 
+void QBoxSetPrivate::setSamples(const QList<qreal> &samples)
+{
+    m_samples.clear();
+    m_sortedCount = 0;
+    m_statisticsPending = false;
+    m_appendCount = 0;
+    for (int i = 0; i < m_valuesCount; i++)
+        m_values[i] = 0.0;
+    if (!appendSamples(samples))
+        emit restructuredBox();
+}
+
+// Keeps the extremes up to date and defers sorting the new samples and computing the quartiles
+// and the median to the next updateStatistics() call. Returns false if none of the samples was valid.
+bool QBoxSetPrivate::appendSamples(const QList<qreal> &samples)
+{
+    const int oldCount = m_samples.count();
+    m_samples.reserve(m_samples.count() + samples.count());
+    foreach (qreal sample, samples) {
+        if (!isValidValue(sample))
+            continue;
+        if (m_samples.isEmpty()) {
+            m_values[QBoxSet::LowerExtreme] = sample;
+            m_values[QBoxSet::UpperExtreme] = sample;
+        } else {
+            m_values[QBoxSet::LowerExtreme] = qMin(m_values[QBoxSet::LowerExtreme], sample);
+            m_values[QBoxSet::UpperExtreme] = qMax(m_values[QBoxSet::UpperExtreme], sample);
+        }
+        m_samples.append(sample);
+    }
+
+    if (m_samples.count() == oldCount)
+        return false;
+
+    m_appendCount = m_valuesCount;
+    m_statisticsPending = true;
+    emit restructuredBox();
+    return true;
+}
+
+// Sorts the samples appended since the last call, merges them into the sorted samples, and
+// reads the quartiles and the median from the result. Does not emit signals, so it can be
+// called from worker threads for different sets at the same time.
+void QBoxSetPrivate::updateStatistics()
+{
+    if (!m_statisticsPending)
+        return;
+    m_statisticsPending = false;
+
+    qreal *begin = m_samples.data();
+    qreal *sortedEnd = begin + m_sortedCount;
+    qreal *end = begin + m_samples.count();
+    std::sort(sortedEnd, end);
+    std::inplace_merge(begin, sortedEnd, end);
+    m_sortedCount = m_samples.count();
+
+    const qreal *upperHalf = begin + m_samples.count() / 2 + m_samples.count() % 2;
+    const qreal median = sortedMedian(begin, end);
+    m_values[QBoxSet::Median] = median;
+    // A single sample has empty halves.
+    m_values[QBoxSet::LowerQuartile] = (m_samples.count() > 1)
+            ? sortedMedian(begin, begin + m_samples.count() / 2) : median;
+    m_values[QBoxSet::UpperQuartile] = (m_samples.count() > 1)
+            ? sortedMedian(upperHalf, end) : median;
+}
+
 #include "moc_qboxset.cpp"
 #include "moc_qboxset_p.cpp"
 
@@ -63,6 +63,10 @@ public:
 
     void clear();
 
+    void setSamples(const QList<qreal> &samples);
+    void appendSamples(const QList<qreal> &samples);
+    int sampleCount() const;
+
     void setLabel(const QString label);
     QString label() const;
 
@@ -42,6 +42,7 @@
 #include <QtCharts/QBoxSet>
 #include <QtCharts/private/qchartglobal_p.h>
 #include <QtCore/QMap>
+#include <QtCore/QVector>
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
 #include <QtGui/QFont>
@@ -68,6 +69,12 @@ public:
 
     qreal value(const int index);
 
+    void setSamples(const QList<qreal> &samples);
+    bool appendSamples(const QList<qreal> &samples);
+    bool hasPendingStatistics() const { return m_statisticsPending; }
+    int sampleCount() const { return m_samples.count(); }
+    void updateStatistics();
+
 Q_SIGNALS:
     void restructuredBox();
     void updatedBox();
@@ -84,6 +91,11 @@ private:
     QBrush m_labelBrush;
     QFont m_labelFont;
     QBoxPlotSeriesPrivate *m_series;
+    // Raw samples the values are computed from. The first m_sortedCount samples are sorted,
+    // the samples appended after them are merged in by updateStatistics().
+    QVector<qreal> m_samples;
+    int m_sortedCount;
+    bool m_statisticsPending;
 
     friend class QBoxSet;
     friend class QBoxPlotSeriesPrivate;
@@ -4,6 +4,9 @@ DEPENDPATH += $$PWD
 SOURCES += \
     $$PWD/candlestick.cpp \
     $$PWD/candlestickchartitem.cpp \
+    $$PWD/candlestickcolumns.cpp \
+    $$PWD/candlestickpyramid.cpp \
+    $$PWD/candlesticktimestampindex.cpp \
     $$PWD/qcandlestickseries.cpp \
     $$PWD/qcandlestickset.cpp \
     $$PWD/qcandlestickmodelmapper.cpp \
@@ -13,6 +16,9 @@ SOURCES += \
 PRIVATE_HEADERS += \
     $$PWD/candlestick_p.h \
     $$PWD/candlestickchartitem_p.h \
+    $$PWD/candlestickcolumns_p.h \
+    $$PWD/candlestickpyramid_p.h \
+    $$PWD/candlesticktimestampindex_p.h \
     $$PWD/candlestickdata_p.h \
     $$PWD/qcandlestickseries_p.h \
     $$PWD/qcandlestickset_p.h \
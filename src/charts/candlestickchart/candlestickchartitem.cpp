@@ -27,16 +27,104 @@
 **
 ****************************************************************************/
 
+#include <QtCharts/QAbstractAxis>
 #include <QtCharts/QCandlestickSeries>
 #include <QtCharts/QCandlestickSet>
+#include <QtCharts/QChart>
+#include <QtCore/QtMath>
+#include <QtGui/QPainter>
+#include <private/abstractdomain_p.h>
 #include <private/candlestickchartitem_p.h>
 #include <private/candlestick_p.h>
 #include <private/candlestickdata_p.h>
 #include <private/qcandlestickseries_p.h>
 #include <private/candlestickanimation_p.h>
+#include <algorithm>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+namespace {
+
+// Geometry of the column data bars of one paint, collected so that each kind of primitive is
+// drawn with a single call.
+class ColumnBatch
+{
+public:
+    ColumnBatch(AbstractDomain *domain, QCandlestickSeries *series)
+        : m_domain(domain),
+          m_maximumColumnWidth(series->maximumColumnWidth()),
+          m_minimumColumnWidth(series->minimumColumnWidth()),
+          m_capsWidth(series->capsWidth())
+    {
+    }
+
+    // Mirrors Candlestick::updateGeometry().
+    void addBar(qreal center, qreal width, qreal open, qreal high, qreal low, qreal close)
+    {
+        const qreal left = center - width / 2.0;
+        const qreal right = left + width;
+        const qreal upperBody = qMax(open, close);
+        const qreal lowerBody = qMin(open, close);
+
+        bool valid;
+        const QPointF upperLeft = m_domain->calculateGeometryPoint(QPointF(left, upperBody), valid);
+        if (!valid)
+            return;
+        const QPointF lowerRight = m_domain->calculateGeometryPoint(QPointF(right, lowerBody),
+                                                                    valid);
+        if (!valid)
+            return;
+        const qreal upperExtreme = m_domain->calculateGeometryPoint(QPointF(left, high), valid).y();
+        if (!valid)
+            return;
+        const qreal lowerExtreme = m_domain->calculateGeometryPoint(QPointF(left, low), valid).y();
+        if (!valid)
+            return;
+
+        QRectF body(upperLeft, lowerRight);
+        if (m_maximumColumnWidth != -1.0 && body.width() > m_maximumColumnWidth) {
+            body.adjust((body.width() - m_maximumColumnWidth) / 2.0, 0.0, 0.0, 0.0);
+            body.setWidth(m_maximumColumnWidth);
+        }
+        if (m_minimumColumnWidth != -1.0 && body.width() < m_minimumColumnWidth) {
+            body.adjust(-(m_minimumColumnWidth - body.width()) / 2.0, 0.0, 0.0, 0.0);
+            body.setWidth(m_minimumColumnWidth);
+        }
+
+        const qreal capsExtra = (body.width() - (body.width() * m_capsWidth)) / 2.0;
+        const qreal capsLeft = body.left() + capsExtra;
+        const qreal capsRight = body.right() - capsExtra;
+        const qreal middle = (capsLeft + capsRight) / 2.0;
+
+        if (high > upperBody) {
+            m_caps.append(QLineF(capsLeft, upperExtreme, capsRight, upperExtreme));
+            m_wicks.append(QLineF(middle, upperExtreme, middle, body.top()));
+        }
+        if (low < lowerBody) {
+            m_caps.append(QLineF(capsLeft, lowerExtreme, capsRight, lowerExtreme));
+            m_wicks.append(QLineF(middle, body.bottom(), middle, lowerExtreme));
+        }
+
+        if (open < close)
+            m_increasing.append(body);
+        else
+            m_decreasing.append(body);
+    }
+
+    QVector<QRectF> m_increasing;
+    QVector<QRectF> m_decreasing;
+    QVector<QLineF> m_wicks;
+    QVector<QLineF> m_caps;
+
+private:
+    AbstractDomain *m_domain;
+    qreal m_maximumColumnWidth;
+    qreal m_minimumColumnWidth;
+    qreal m_capsWidth;
+};
+
+}
+
 CandlestickChartItem::CandlestickChartItem(QCandlestickSeries *series, QGraphicsItem *item)
     : ChartItem(series->d_func(), item),
       m_series(series),
@@ -55,6 +143,7 @@ CandlestickChartItem::CandlestickChartItem(QCandlestickSeries *series, QGraphics
     connect(series->d_func(), SIGNAL(updatedLayout()), this, SLOT(handleLayoutUpdated()));
     connect(series->d_func(), SIGNAL(updatedCandlesticks()),
             this, SLOT(handleCandlesticksUpdated()));
+    connect(series, SIGNAL(columnDataChanged()), this, SLOT(handleColumnDataChanged()));
 
     setZValue(ChartPresenter::CandlestickSeriesZValue);
 
@@ -85,9 +174,11 @@ QRectF CandlestickChartItem::boundingRect() const
 void CandlestickChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                                  QWidget *widget)
 {
-    Q_UNUSED(painter);
     Q_UNUSED(option);
     Q_UNUSED(widget);
+
+    if (!m_series->d_func()->columns().isEmpty())
+        paintColumnData(painter);
 }
 
 void CandlestickChartItem::handleDomainUpdated()
@@ -98,6 +189,7 @@ void CandlestickChartItem::handleDomainUpdated()
     // Set bounding rectangle to same as domain size. Add one pixel at the top (-1.0) and the bottom
     // as 0.0 would snip a bit off from the wick at the grid line.
     m_boundingRect.setRect(0.0, -1.0, domain()->size().width(), domain()->size().height() + 1.0);
+    update();
 
     foreach (Candlestick *item, m_candlesticks.values()) {
         item->updateGeometry(domain());
@@ -114,14 +206,16 @@ void CandlestickChartItem::handleLayoutUpdated()
         qreal oldTimestamp = m_candlesticks.value(set)->m_data.m_timestamp;
         qreal newTimestamp = set->timestamp();
         if (Q_UNLIKELY(oldTimestamp != newTimestamp)) {
-            removeTimestamp(oldTimestamp);
-            addTimestamp(newTimestamp);
+            m_timestamps.remove(oldTimestamp);
+            m_timestamps.insert(newTimestamp);
             timestampChanged = true;
         }
     }
     if (timestampChanged)
         updateTimePeriod();
 
+    update();
+
     foreach (Candlestick *item, m_candlesticks.values()) {
         if (m_animation)
             m_animation->setAnimationStart(item);
@@ -144,6 +238,9 @@ void CandlestickChartItem::handleCandlesticksUpdated()
 {
     foreach (QCandlestickSet *set, m_candlesticks.keys())
         updateCandlestickAppearance(m_candlesticks.value(set), set);
+
+    // Column data is painted by this item itself.
+    update();
 }
 
 void CandlestickChartItem::handleCandlestickSeriesChange()
@@ -176,6 +273,9 @@ void CandlestickChartItem::handleCandlestickSeriesChange()
 
 void CandlestickChartItem::handleCandlestickSetsAdd(const QList<QCandlestickSet *> &sets)
 {
+    QVector<qreal> timestamps;
+    timestamps.reserve(sets.count());
+
     foreach (QCandlestickSet *set, sets) {
         Candlestick *item = m_candlesticks.value(set, 0);
         if (item) {
@@ -185,7 +285,7 @@ void CandlestickChartItem::handleCandlestickSetsAdd(const QList<QCandlestickSet
 
         item = new Candlestick(set, domain(), this);
         m_candlesticks.insert(set, item);
-        addTimestamp(set->timestamp());
+        timestamps.append(set->timestamp());
 
         connect(item, SIGNAL(clicked(QCandlestickSet *)),
                 m_series, SIGNAL(clicked(QCandlestickSet *)));
@@ -204,6 +304,8 @@ void CandlestickChartItem::handleCandlestickSetsAdd(const QList<QCandlestickSet
         connect(item, SIGNAL(doubleClicked(QCandlestickSet *)), set, SIGNAL(doubleClicked()));
     }
 
+    m_timestamps.insert(timestamps);
+
     handleDataStructureChanged();
 }
 
@@ -213,7 +315,7 @@ void CandlestickChartItem::handleCandlestickSetsRemove(const QList<QCandlestickS
         Candlestick *item = m_candlesticks.value(set);
 
         m_candlesticks.remove(set);
-        removeTimestamp(set->timestamp());
+        m_timestamps.remove(set->timestamp());
 
         if (m_animation) {
             ChartAnimation *animation = m_animation->candlestickAnimation(item);
@@ -249,6 +351,11 @@ void CandlestickChartItem::handleDataStructureChanged()
     handleDomainUpdated();
 }
 
+void CandlestickChartItem::handleColumnDataChanged()
+{
+    update();
+}
+
 bool CandlestickChartItem::updateCandlestickGeometry(Candlestick *item, int index)
 {
     bool changed = false;
@@ -307,23 +414,6 @@ void CandlestickChartItem::updateCandlestickAppearance(Candlestick *item, QCandl
         item->setPen(set->pen());
 }
 
-void CandlestickChartItem::addTimestamp(qreal timestamp)
-{
-    int index = 0;
-    for (int i = m_timestamps.count() - 1; i >= 0; --i) {
-        if (timestamp > m_timestamps.at(i)) {
-            index = i + 1;
-            break;
-        }
-    }
-    m_timestamps.insert(index, timestamp);
-}
-
-void CandlestickChartItem::removeTimestamp(qreal timestamp)
-{
-    m_timestamps.removeOne(timestamp);
-}
-
 void CandlestickChartItem::updateTimePeriod()
 {
     if (m_timestamps.count() == 0) {
@@ -336,11 +426,125 @@ void CandlestickChartItem::updateTimePeriod()
         return;
     }
 
-    qreal timePeriod = qAbs(m_timestamps.at(1) - m_timestamps.at(0));
-    for (int i = 1; i < m_timestamps.count(); ++i) {
-        timePeriod = qMin(timePeriod, qAbs(m_timestamps.at(i) - m_timestamps.at(i - 1)));
+    m_timePeriod = m_timestamps.minimumPeriod();
+}
+
+void CandlestickChartItem::paintColumnData(QPainter *painter)
+{
+    const CandlestickColumns &columns = m_series->d_func()->columns();
+
+    if (m_boundingRect.isEmpty() || !m_series->chart())
+        return;
+
+    QList<QAbstractAxis *> axes = m_series->chart()->axes(Qt::Horizontal, m_series);
+    if (axes.isEmpty())
+        return;
+
+    const qreal minX = domain()->minX();
+    const qreal maxX = domain()->maxX();
+    if (maxX <= minX)
+        return;
+
+    // Bars are positioned like the candlestick items: at their index in the category mode and
+    // at their timestamp otherwise. The spacing is the distance between two adjacent bars.
+    const bool categories = (axes.first()->type() == QAbstractAxis::AxisTypeBarCategory);
+    const qreal unitsPerPixel = (maxX - minX) / domain()->size().width();
+    const QVector<qreal> *timestamps = &columns.timestamps();
+    const QVector<qreal> *openValues = &columns.open();
+    const QVector<qreal> *highValues = &columns.high();
+    const QVector<qreal> *lowValues = &columns.low();
+    const QVector<qreal> *closeValues = &columns.close();
+    qreal basePeriod;
+    qreal spacing;
+    qreal columnWidth;
+    qreal offset = 0.0;
+    qreal shift = 0.0;
+    int first;
+    int last;
+    if (categories) {
+        columnWidth = 1.0 / qMax(1, m_seriesCount);
+        basePeriod = 1.0;
+        spacing = 1.0;
+        offset = -0.5 + m_seriesIndex * columnWidth + columnWidth / 2.0;
+        first = qBound(0, qFloor(minX - offset), columns.count());
+        last = qBound(0, qCeil(maxX - offset) + 1, columns.count());
+    } else {
+        basePeriod = columns.timePeriod();
+        if (basePeriod == 0.0)
+            basePeriod = maxX - minX;
+        spacing = basePeriod;
+
+        // Draw from the finest summary level whose bars are at least a pixel apart.
+        if (columns.timePeriod() > 0.0) {
+            const CandlestickPyramid &pyramid = m_series->d_func()->columnPyramid();
+            const int level = pyramid.selectLevel(unitsPerPixel);
+            if (level > 0) {
+                const CandlestickPyramid::Level &summary = pyramid.level(level);
+                timestamps = &summary.timestamps;
+                openValues = &summary.open;
+                highValues = &summary.high;
+                lowValues = &summary.low;
+                closeValues = &summary.close;
+                spacing = pyramid.period(level);
+                // Summary bars are stamped with the start of their bucket, while the bars they
+                // combine are centered on their timestamps.
+                shift = (spacing - basePeriod) / 2.0;
+            }
+        }
+
+        columnWidth = spacing;
+        first = int(std::lower_bound(timestamps->constBegin(), timestamps->constEnd(),
+                                     minX - spacing) - timestamps->constBegin());
+        last = int(std::upper_bound(timestamps->constBegin(), timestamps->constEnd(),
+                                    maxX + spacing) - timestamps->constBegin());
     }
-    m_timePeriod = timePeriod;
+    if (first >= last)
+        return;
+
+    // When bars are still less than a pixel apart, combine each run of 'factor' bars into one
+    // bar of a coarser period. The runs are aligned to the first bar, not to the visible window,
+    // so that panning does not change the combined values.
+    const qreal spacingInPixels = spacing / unitsPerPixel;
+    const int factor = (spacingInPixels < 1.0) ? qCeil(1.0 / spacingInPixels) : 1;
+    const qreal bodyWidth = m_series->bodyWidth() * columnWidth * factor;
+    const qreal origin = categories ? 0.0 : columns.timestamps().first();
+    const qreal span = spacing * factor;
+
+    ColumnBatch batch(domain(), m_series);
+    if (factor == 1) {
+        for (int i = first; i < last; ++i) {
+            const qreal center = categories ? i + offset : timestamps->at(i) + shift;
+            batch.addBar(center, bodyWidth, openValues->at(i), highValues->at(i),
+                         lowValues->at(i), closeValues->at(i));
+        }
+    } else {
+        CandlestickPyramid::Level runs;
+        CandlestickPyramid::combineRuns(categories ? 0 : timestamps, *openValues, *highValues,
+                                        *lowValues, *closeValues, first, last, origin, span,
+                                        runs);
+        for (int i = 0; i < runs.buckets.count(); ++i) {
+            batch.addBar(origin + offset + (runs.buckets.at(i) + 0.5) * span - basePeriod / 2.0,
+                         bodyWidth, runs.open.at(i), runs.high.at(i), runs.low.at(i),
+                         runs.close.at(i));
+        }
+    }
+
+    QBrush brush(m_series->brush());
+    painter->save();
+    painter->setClipRect(m_boundingRect);
+    painter->setPen(m_series->pen());
+    if (m_series->capsVisible())
+        painter->drawLines(batch.m_caps);
+    painter->drawLines(batch.m_wicks);
+    if (!m_series->bodyOutlineVisible())
+        painter->setPen(QColor(Qt::transparent));
+    brush.setColor(m_series->increasingColor());
+    painter->setBrush(brush);
+    painter->drawRects(batch.m_increasing);
+    brush.setColor(m_series->decreasingColor());
+    painter->setBrush(brush);
+    painter->drawRects(batch.m_decreasing);
+    painter->restore();
 }
 
 #include "moc_candlestickchartitem_p.cpp"
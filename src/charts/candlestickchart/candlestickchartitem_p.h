@@ -39,6 +39,7 @@
 #ifndef CANDLESTICKCHARTITEM_P_H
 #define CANDLESTICKCHARTITEM_P_H
 
+#include <private/candlesticktimestampindex_p.h>
 #include <private/chartitem_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
 
@@ -72,22 +73,23 @@ private Q_SLOTS:
     void handleCandlestickSetsAdd(const QList<QCandlestickSet *> &sets);
     void handleCandlestickSetsRemove(const QList<QCandlestickSet *> &sets);
     void handleDataStructureChanged();
+    void handleColumnDataChanged();
 
 private:
     bool updateCandlestickGeometry(Candlestick *item, int index);
     void updateCandlestickAppearance(Candlestick *item, QCandlestickSet *set);
 
-    void addTimestamp(qreal timestamp);
-    void removeTimestamp(qreal timestamp);
     void updateTimePeriod();
 
+    void paintColumnData(QPainter *painter);
+
 protected:
     QRectF m_boundingRect;
     QCandlestickSeries *m_series; // Not owned.
     int m_seriesIndex;
     int m_seriesCount;
     QHash<QCandlestickSet *, Candlestick *> m_candlesticks;
-    QList<qreal> m_timestamps;
+    CandlestickTimestampIndex m_timestamps;
     qreal m_timePeriod;
     CandlestickAnimation *m_animation;
 };
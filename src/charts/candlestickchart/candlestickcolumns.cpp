@@ -0,0 +1,179 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/candlestickcolumns_p.h>
+#include <algorithm>
+#include <numeric>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+namespace {
+
+struct TimestampOrder
+{
+    TimestampOrder(const QVector<qreal> &timestamps) : m_timestamps(timestamps) {}
+
+    bool operator()(int a, int b) const { return m_timestamps.at(a) < m_timestamps.at(b); }
+
+    const QVector<qreal> &m_timestamps;
+};
+
+}
+
+CandlestickColumns::CandlestickColumns()
+    : m_timePeriod(0.0),
+      m_minY(0.0),
+      m_maxY(0.0)
+{
+}
+
+// Replaces the bars. Fails if the arrays are not of the same size. Unsorted input is sorted by
+// timestamp; bars with equal timestamps keep their relative order.
+bool CandlestickColumns::set(const QVector<qreal> &timestamps, const QVector<qreal> &open,
+                             const QVector<qreal> &high, const QVector<qreal> &low,
+                             const QVector<qreal> &close)
+{
+    const int count = timestamps.size();
+    if (open.size() != count || high.size() != count || low.size() != count
+        || close.size() != count) {
+        return false;
+    }
+
+    if (std::is_sorted(timestamps.constBegin(), timestamps.constEnd())) {
+        m_timestamps = timestamps;
+        m_open = open;
+        m_high = high;
+        m_low = low;
+        m_close = close;
+    } else {
+        QVector<int> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), TimestampOrder(timestamps));
+        m_timestamps.resize(count);
+        m_open.resize(count);
+        m_high.resize(count);
+        m_low.resize(count);
+        m_close.resize(count);
+        for (int i = 0; i < count; ++i) {
+            const int j = order.at(i);
+            m_timestamps[i] = timestamps.at(j);
+            m_open[i] = open.at(j);
+            m_high[i] = high.at(j);
+            m_low[i] = low.at(j);
+            m_close[i] = close.at(j);
+        }
+    }
+
+    m_timePeriod = 0.0;
+    for (int i = 0; i < count; ++i) {
+        if (i == 0) {
+            m_minY = m_low.at(0);
+            m_maxY = m_high.at(0);
+        } else {
+            includePeriod(m_timestamps.at(i) - m_timestamps.at(i - 1));
+            includeRange(m_low.at(i), m_high.at(i));
+        }
+    }
+
+    return true;
+}
+
+// Adds a bar. Appending in timestamp order is constant time; an out of order bar is inserted
+// at its sorted position.
+void CandlestickColumns::append(qreal timestamp, qreal open, qreal high, qreal low, qreal close)
+{
+    const int index = upperBound(timestamp);
+
+    if (isEmpty()) {
+        m_minY = low;
+        m_maxY = high;
+    } else {
+        includeRange(low, high);
+    }
+    // Splitting a gap only creates smaller gaps, so the minimum stays valid.
+    if (index > 0)
+        includePeriod(timestamp - m_timestamps.at(index - 1));
+    if (index < count())
+        includePeriod(m_timestamps.at(index) - timestamp);
+
+    if (index == count()) {
+        m_timestamps.append(timestamp);
+        m_open.append(open);
+        m_high.append(high);
+        m_low.append(low);
+        m_close.append(close);
+    } else {
+        m_timestamps.insert(index, timestamp);
+        m_open.insert(index, open);
+        m_high.insert(index, high);
+        m_low.insert(index, low);
+        m_close.insert(index, close);
+    }
+}
+
+void CandlestickColumns::clear()
+{
+    m_timestamps.clear();
+    m_open.clear();
+    m_high.clear();
+    m_low.clear();
+    m_close.clear();
+    m_timePeriod = 0.0;
+    m_minY = 0.0;
+    m_maxY = 0.0;
+}
+
+// Returns the index of the first bar whose timestamp is not less than \a timestamp.
+int CandlestickColumns::lowerBound(qreal timestamp) const
+{
+    return int(std::lower_bound(m_timestamps.constBegin(), m_timestamps.constEnd(), timestamp)
+               - m_timestamps.constBegin());
+}
+
+// Returns the index of the first bar whose timestamp is greater than \a timestamp.
+int CandlestickColumns::upperBound(qreal timestamp) const
+{
+    return int(std::upper_bound(m_timestamps.constBegin(), m_timestamps.constEnd(), timestamp)
+               - m_timestamps.constBegin());
+}
+
+void CandlestickColumns::includePeriod(qreal period)
+{
+    if (period > 0.0 && (m_timePeriod == 0.0 || period < m_timePeriod))
+        m_timePeriod = period;
+}
+
+void CandlestickColumns::includeRange(qreal low, qreal high)
+{
+    m_minY = qMin(m_minY, low);
+    m_maxY = qMax(m_maxY, high);
+}
+
+QT_CHARTS_END_NAMESPACE
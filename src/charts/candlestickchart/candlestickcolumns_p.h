@@ -0,0 +1,97 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef CANDLESTICKCOLUMNS_P_H
+#define CANDLESTICKCOLUMNS_P_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QVector>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Columnar OHLC storage of a candlestick series. The bars are kept in contiguous arrays sorted
+// by timestamp, so that the bars of a time window can be found with a binary search. The
+// value range and the smallest positive distance between two consecutive timestamps are
+// maintained as bars are added.
+class QT_CHARTS_PRIVATE_EXPORT CandlestickColumns
+{
+public:
+    CandlestickColumns();
+
+    bool set(const QVector<qreal> &timestamps, const QVector<qreal> &open,
+             const QVector<qreal> &high, const QVector<qreal> &low, const QVector<qreal> &close);
+    void append(qreal timestamp, qreal open, qreal high, qreal low, qreal close);
+    void clear();
+
+    int count() const { return m_timestamps.size(); }
+    bool isEmpty() const { return m_timestamps.isEmpty(); }
+
+    const QVector<qreal> &timestamps() const { return m_timestamps; }
+    const QVector<qreal> &open() const { return m_open; }
+    const QVector<qreal> &high() const { return m_high; }
+    const QVector<qreal> &low() const { return m_low; }
+    const QVector<qreal> &close() const { return m_close; }
+
+    int lowerBound(qreal timestamp) const;
+    int upperBound(qreal timestamp) const;
+
+    qreal timePeriod() const { return m_timePeriod; }
+    qreal minY() const { return m_minY; }
+    qreal maxY() const { return m_maxY; }
+
+private:
+    void includePeriod(qreal period);
+    void includeRange(qreal low, qreal high);
+
+private:
+    QVector<qreal> m_timestamps;
+    QVector<qreal> m_open;
+    QVector<qreal> m_high;
+    QVector<qreal> m_low;
+    QVector<qreal> m_close;
+    // Zero until there are two bars with different timestamps.
+    qreal m_timePeriod;
+    qreal m_minY;
+    qreal m_maxY;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // CANDLESTICKCOLUMNS_P_H
@@ -0,0 +1,287 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/candlestickcolumns_p.h>
+#include <private/candlestickpyramid_p.h>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtCore/QThread>
+#include <QtCore/QtMath>
+#include <algorithm>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+namespace {
+
+// Each level's buckets are this many times longer than those of the level below.
+const int levelFactor = 4;
+// Levels are added until the coarsest one has at most this many bars.
+const int maximumCoarsestLevelCount = 512;
+// Below this many bars, building the pyramid on the calling thread is cheaper than
+// dispatching it to the thread pool.
+const int parallelPyramidThreshold = 100000;
+
+void appendBar(CandlestickPyramid::Level &level, qint64 bucket, qreal timestamp, qreal open,
+               qreal high, qreal low, qreal close)
+{
+    if (!level.buckets.isEmpty() && level.buckets.last() == bucket) {
+        qreal &levelHigh = level.high.last();
+        qreal &levelLow = level.low.last();
+        levelHigh = qMax(levelHigh, high);
+        levelLow = qMin(levelLow, low);
+        level.close.last() = close;
+    } else {
+        level.timestamps.append(timestamp);
+        level.buckets.append(bucket);
+        level.open.append(open);
+        level.high.append(high);
+        level.low.append(low);
+        level.close.append(close);
+    }
+}
+
+void appendLevel(CandlestickPyramid::Level &level, const CandlestickPyramid::Level &other)
+{
+    level.timestamps += other.timestamps;
+    level.buckets += other.buckets;
+    level.open += other.open;
+    level.high += other.high;
+    level.low += other.low;
+    level.close += other.close;
+}
+
+// A range of the column data that starts at a bucket boundary of the coarsest level, so that
+// the levels of the ranges can be built independently and concatenated.
+struct PyramidChunk
+{
+    const CandlestickColumns *columns;
+    int begin;
+    int end;
+    qreal origin;
+    qreal period;
+    QVector<CandlestickPyramid::Level> levels;
+};
+
+void buildPyramidChunk(PyramidChunk &chunk)
+{
+    const QVector<qreal> &timestamps = chunk.columns->timestamps();
+    const QVector<qreal> &open = chunk.columns->open();
+    const QVector<qreal> &high = chunk.columns->high();
+    const QVector<qreal> &low = chunk.columns->low();
+    const QVector<qreal> &close = chunk.columns->close();
+
+    CandlestickPyramid::Level &first = chunk.levels[0];
+    for (int i = chunk.begin; i < chunk.end; ++i) {
+        const qint64 bucket = qint64(std::floor((timestamps.at(i) - chunk.origin) / chunk.period));
+        appendBar(first, bucket, chunk.origin + bucket * chunk.period, open.at(i), high.at(i),
+                  low.at(i), close.at(i));
+    }
+
+    qreal period = chunk.period;
+    for (int k = 1; k < chunk.levels.count(); ++k) {
+        const CandlestickPyramid::Level &source = chunk.levels.at(k - 1);
+        CandlestickPyramid::Level &level = chunk.levels[k];
+        period *= levelFactor;
+        for (int i = 0; i < source.buckets.count(); ++i) {
+            const qint64 bucket = source.buckets.at(i) / levelFactor;
+            appendBar(level, bucket, chunk.origin + bucket * period, source.open.at(i),
+                      source.high.at(i), source.low.at(i), source.close.at(i));
+        }
+    }
+}
+
+struct CoarsestBucketBefore
+{
+    CoarsestBucketBefore(qreal origin, qreal period, qint64 divisor, qint64 bucket)
+        : m_origin(origin), m_period(period), m_divisor(divisor), m_bucket(bucket) {}
+
+    bool operator()(qreal timestamp) const
+    {
+        return qint64(std::floor((timestamp - m_origin) / m_period)) / m_divisor < m_bucket;
+    }
+
+    qreal m_origin;
+    qreal m_period;
+    qint64 m_divisor;
+    qint64 m_bucket;
+};
+
+}
+
+CandlestickPyramid::CandlestickPyramid()
+    : m_valid(false),
+      m_origin(0.0),
+      m_basePeriod(0.0)
+{
+}
+
+void CandlestickPyramid::update(const CandlestickColumns &columns)
+{
+    if (m_valid)
+        return;
+
+    const int chunkCount = (columns.count() >= parallelPyramidThreshold)
+            ? qMax(1, QThread::idealThreadCount() * 4) : 1;
+    build(columns, chunkCount);
+}
+
+// Rebuilds the pyramid from \a columns, splitting the data into at most \a chunkCount ranges
+// that are built in parallel. The result does not depend on the number of chunks.
+void CandlestickPyramid::build(const CandlestickColumns &columns, int chunkCount)
+{
+    m_valid = true;
+    m_levels.clear();
+    m_basePeriod = columns.timePeriod();
+    if (columns.count() < 2 || m_basePeriod <= 0.0)
+        return;
+
+    const QVector<qreal> &timestamps = columns.timestamps();
+    m_origin = timestamps.first();
+    const qreal range = timestamps.last() - m_origin;
+
+    int levelCount = 0;
+    qreal period = m_basePeriod;
+    qint64 divisor = 1;
+    qreal estimatedCount = columns.count();
+    while (estimatedCount > maximumCoarsestLevelCount) {
+        period *= levelFactor;
+        if (levelCount)
+            divisor *= levelFactor;
+        levelCount++;
+        estimatedCount = qMin(estimatedCount, range / period + 1.0);
+    }
+    if (!levelCount)
+        return;
+
+    // Split the data at coarsest bucket boundaries near evenly spaced indices.
+    const qreal firstPeriod = m_basePeriod * levelFactor;
+    QVector<PyramidChunk> chunks;
+    int begin = 0;
+    for (int j = 1; j <= chunkCount && begin < columns.count(); ++j) {
+        int end = columns.count();
+        if (j < chunkCount) {
+            const int index = qMax(begin, int(qint64(columns.count()) * j / chunkCount));
+            const qint64 bucket = qint64(std::floor((timestamps.at(index) - m_origin)
+                                                    / firstPeriod)) / divisor;
+            end = int(std::partition_point(timestamps.constBegin() + begin, timestamps.constEnd(),
+                                           CoarsestBucketBefore(m_origin, firstPeriod, divisor,
+                                                                bucket))
+                      - timestamps.constBegin());
+        }
+        if (end > begin) {
+            PyramidChunk chunk;
+            chunk.columns = &columns;
+            chunk.begin = begin;
+            chunk.end = end;
+            chunk.origin = m_origin;
+            chunk.period = firstPeriod;
+            chunk.levels.resize(levelCount);
+            chunks.append(chunk);
+        }
+        begin = end;
+    }
+
+    if (chunks.count() > 1) {
+        QtConcurrent::blockingMap(chunks, buildPyramidChunk);
+    } else {
+        for (int i = 0; i < chunks.count(); ++i)
+            buildPyramidChunk(chunks[i]);
+    }
+
+    m_levels.resize(levelCount);
+    for (int i = 0; i < chunks.count(); ++i) {
+        for (int k = 0; k < levelCount; ++k)
+            appendLevel(m_levels[k], chunks.at(i).levels.at(k));
+    }
+}
+
+// Updates the pyramid after a bar was added to \a columns. Only a bar appended after the last
+// one with an unchanged time period can be merged into the levels; other changes invalidate
+// the pyramid.
+void CandlestickPyramid::append(const CandlestickColumns &columns, bool atEnd)
+{
+    if (!m_valid)
+        return;
+
+    if (!atEnd || m_levels.isEmpty() || columns.timePeriod() != m_basePeriod
+        || m_levels.last().buckets.count() > 2 * maximumCoarsestLevelCount) {
+        invalidate();
+        return;
+    }
+
+    const int index = columns.count() - 1;
+    const qreal timestamp = columns.timestamps().at(index);
+    qreal period = m_basePeriod;
+    qint64 bucket = 0;
+    for (int k = 0; k < m_levels.count(); ++k) {
+        period *= levelFactor;
+        bucket = k ? bucket / levelFactor
+                   : qint64(std::floor((timestamp - m_origin) / period));
+        appendBar(m_levels[k], bucket, m_origin + bucket * period, columns.open().at(index),
+                  columns.high().at(index), columns.low().at(index), columns.close().at(index));
+    }
+}
+
+// Returns the time period of the bars of \a level.
+qreal CandlestickPyramid::period(int level) const
+{
+    qreal period = m_basePeriod;
+    for (int k = 0; k < level; ++k)
+        period *= levelFactor;
+    return period;
+}
+
+// Returns the finest level whose bars are at least \a minimumPeriod apart, or the coarsest
+// level if there is none.
+int CandlestickPyramid::selectLevel(qreal minimumPeriod) const
+{
+    int level = 0;
+    while (level < m_levels.count() && period(level) < minimumPeriod)
+        ++level;
+    return level;
+}
+
+// Combines the bars from first to last - 1 into one bar for each run of consecutive bars that
+// fall into the same bucket of length span, counted from origin, and appends the combined bars
+// to runs. The position of a bar is its timestamp, or its index if timestamps is null, as on
+// bar category axes.
+void CandlestickPyramid::combineRuns(const QVector<qreal> *timestamps, const QVector<qreal> &open,
+                                     const QVector<qreal> &high, const QVector<qreal> &low,
+                                     const QVector<qreal> &close, int first, int last,
+                                     qreal origin, qreal span, Level &runs)
+{
+    for (int i = first; i < last; ++i) {
+        const qreal position = timestamps ? timestamps->at(i) : qreal(i);
+        const qint64 bucket = qint64(std::floor((position - origin) / span));
+        appendBar(runs, bucket, origin + bucket * span, open.at(i), high.at(i), low.at(i),
+                  close.at(i));
+    }
+}
+
+QT_CHARTS_END_NAMESPACE
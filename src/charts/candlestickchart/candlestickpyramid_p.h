@@ -0,0 +1,99 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+
+#ifndef CANDLESTICKPYRAMID_P_H
+#define CANDLESTICKPYRAMID_P_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QVector>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class CandlestickColumns;
+
+// Multi-resolution OHLC summary of the column data of a candlestick series. Level 0 is the
+// column data itself. Each further level combines the bars of time buckets that are a fixed
+// factor longer than those of the level below; the buckets of all levels are aligned to the
+// first bar, so every bucket is covered by whole buckets of the finer levels. Levels are added
+// until the coarsest one has only a few hundred bars, so that a level with a bounded number
+// of bars per pixel exists for any zoom.
+//
+// The pyramid is built on first use, in parallel for large data, kept up to date when bars are
+// appended in timestamp order, and rebuilt lazily after other changes.
+class QT_CHARTS_PRIVATE_EXPORT CandlestickPyramid
+{
+public:
+    struct Level
+    {
+        // Start times of the buckets, and their bucket indices counted from the first bar.
+        QVector<qreal> timestamps;
+        QVector<qint64> buckets;
+        QVector<qreal> open;
+        QVector<qreal> high;
+        QVector<qreal> low;
+        QVector<qreal> close;
+    };
+
+    CandlestickPyramid();
+
+    void invalidate() { m_valid = false; }
+    void update(const CandlestickColumns &columns);
+    void build(const CandlestickColumns &columns, int chunkCount);
+    void append(const CandlestickColumns &columns, bool atEnd);
+
+    int levelCount() const { return m_levels.count() + 1; }
+    qreal period(int level) const;
+    const Level &level(int level) const { return m_levels.at(level - 1); }
+    int selectLevel(qreal minimumPeriod) const;
+
+    static void combineRuns(const QVector<qreal> *timestamps, const QVector<qreal> &open,
+                            const QVector<qreal> &high, const QVector<qreal> &low,
+                            const QVector<qreal> &close, int first, int last, qreal origin,
+                            qreal span, Level &runs);
+
+private:
+    bool m_valid;
+    qreal m_origin;
+    qreal m_basePeriod;
+    QVector<Level> m_levels;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // CANDLESTICKPYRAMID_P_H
@@ -0,0 +1,164 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/candlesticktimestampindex_p.h>
+#include <algorithm>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+CandlestickTimestampIndex::CandlestickTimestampIndex()
+    : m_count(0)
+{
+}
+
+void CandlestickTimestampIndex::insert(qreal timestamp)
+{
+    QMap<qreal, int>::iterator it = m_timestamps.lowerBound(timestamp);
+    if (it != m_timestamps.end() && it.key() == timestamp) {
+        // A duplicate adds a zero distance.
+        ++it.value();
+        addGap(0.0);
+    } else {
+        const bool hasNext = (it != m_timestamps.end());
+        const bool hasPrevious = (it != m_timestamps.begin());
+        const qreal next = hasNext ? it.key() : 0.0;
+        const qreal previous = hasPrevious ? (it - 1).key() : 0.0;
+        if (hasPrevious && hasNext)
+            removeGap(next - previous);
+        if (hasPrevious)
+            addGap(timestamp - previous);
+        if (hasNext)
+            addGap(next - timestamp);
+        m_timestamps.insert(it, timestamp, 1);
+    }
+    ++m_count;
+}
+
+void CandlestickTimestampIndex::insert(const QVector<qreal> &timestamps)
+{
+    // Inserting a few timestamps one by one is cheaper than merging them with many.
+    if (timestamps.count() * 8 < m_count) {
+        foreach (qreal timestamp, timestamps)
+            insert(timestamp);
+        return;
+    }
+
+    QVector<qreal> current;
+    current.reserve(m_count);
+    for (QMap<qreal, int>::const_iterator it = m_timestamps.constBegin();
+         it != m_timestamps.constEnd(); ++it) {
+        for (int i = 0; i < it.value(); ++i)
+            current.append(it.key());
+    }
+
+    QVector<qreal> added(timestamps);
+    std::sort(added.begin(), added.end());
+
+    QVector<qreal> merged(current.count() + added.count());
+    std::merge(current.constBegin(), current.constEnd(), added.constBegin(), added.constEnd(),
+               merged.begin());
+    rebuild(merged);
+}
+
+void CandlestickTimestampIndex::remove(qreal timestamp)
+{
+    QMap<qreal, int>::iterator it = m_timestamps.find(timestamp);
+    if (it == m_timestamps.end())
+        return;
+
+    if (it.value() > 1) {
+        --it.value();
+        removeGap(0.0);
+    } else {
+        QMap<qreal, int>::iterator next = it + 1;
+        const bool hasNext = (next != m_timestamps.end());
+        const bool hasPrevious = (it != m_timestamps.begin());
+        const qreal previous = hasPrevious ? (it - 1).key() : 0.0;
+        if (hasPrevious)
+            removeGap(timestamp - previous);
+        if (hasNext)
+            removeGap(next.key() - timestamp);
+        if (hasPrevious && hasNext)
+            addGap(next.key() - previous);
+        m_timestamps.erase(it);
+    }
+    --m_count;
+}
+
+void CandlestickTimestampIndex::clear()
+{
+    m_timestamps.clear();
+    m_gaps.clear();
+    m_count = 0;
+}
+
+// Returns the smallest distance between two adjacent timestamps, or zero if there are less
+// than two timestamps.
+qreal CandlestickTimestampIndex::minimumPeriod() const
+{
+    return m_gaps.isEmpty() ? 0.0 : m_gaps.firstKey();
+}
+
+void CandlestickTimestampIndex::addGap(qreal gap)
+{
+    ++m_gaps[gap];
+}
+
+void CandlestickTimestampIndex::removeGap(qreal gap)
+{
+    QMap<qreal, int>::iterator it = m_gaps.find(gap);
+    if (it == m_gaps.end())
+        return;
+    if (--it.value() == 0)
+        m_gaps.erase(it);
+}
+
+// Replaces the contents with the sorted \a timestamps. The keys arrive in order, so they are
+// appended at the end of the timestamp map.
+void CandlestickTimestampIndex::rebuild(const QVector<qreal> &timestamps)
+{
+    clear();
+
+    for (int i = 0; i < timestamps.count(); ++i) {
+        const qreal timestamp = timestamps.at(i);
+        if (i > 0) {
+            const qreal gap = timestamp - timestamps.at(i - 1);
+            addGap(gap);
+            if (gap == 0.0) {
+                ++(m_timestamps.end() - 1).value();
+                continue;
+            }
+        }
+        m_timestamps.insert(m_timestamps.constEnd(), timestamp, 1);
+    }
+    m_count = timestamps.count();
+}
+
+QT_CHARTS_END_NAMESPACE
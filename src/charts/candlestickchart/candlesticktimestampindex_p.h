@@ -0,0 +1,81 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+
+#ifndef CANDLESTICKTIMESTAMPINDEX_P_H
+#define CANDLESTICKTIMESTAMPINDEX_P_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QMap>
+#include <QtCore/QVector>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Sorted multiset of the timestamps of the candlestick items of a series. Next to the
+// timestamps, the distances between adjacent timestamps are kept in a sorted multiset, so that
+// the smallest distance, which defines the time period of the candlesticks, is available in
+// constant time. Single inserts and removals are logarithmic; inserting many timestamps at
+// once sorts them and merges them with the existing ones.
+class QT_CHARTS_PRIVATE_EXPORT CandlestickTimestampIndex
+{
+public:
+    CandlestickTimestampIndex();
+
+    void insert(qreal timestamp);
+    void insert(const QVector<qreal> &timestamps);
+    void remove(qreal timestamp);
+    void clear();
+
+    int count() const { return m_count; }
+    qreal minimumPeriod() const;
+
+private:
+    void addGap(qreal gap);
+    void removeGap(qreal gap);
+    void rebuild(const QVector<qreal> &timestamps);
+
+private:
+    // Both maps store the number of occurrences of each key.
+    QMap<qreal, int> m_timestamps;
+    QMap<qreal, int> m_gaps;
+    int m_count;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // CANDLESTICKTIMESTAMPINDEX_P_H
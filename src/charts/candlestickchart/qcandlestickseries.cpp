@@ -33,6 +33,7 @@
 #include <QtCharts/QCandlestickSet>
 #include <QtCharts/QValueAxis>
 #include <QtCore/QDateTime>
+#include <QtCore/QSet>
 #include <private/candlestickanimation_p.h>
 #include <private/candlestickchartitem_p.h>
 #include <private/chartdataset_p.h>
@@ -53,6 +54,17 @@ QT_CHARTS_BEGIN_NAMESPACE
     when using QBarCategoryAxis. QDateTimeAxis and QValueAxis can be used as alternatives to
     QBarCategoryAxis. In this case, each candlestick item is drawn according to its timestamp value.
 
+    For large data sets, the series can also hold bars as columnar data, which is set with
+    setColumnData(). Column data is stored in plain arrays without a QCandlestickSet per bar
+    and is drawn in one pass, so only the bars of the visible time window are processed. When
+    several bars fall within one pixel, they are combined into a single candlestick covering
+    their joint period. For this, the series keeps summaries of the column data at
+    successively coarser periods and picks the one that matches the visible time span and the
+    width of the plot area, so the number of candlesticks processed per paint stays bounded
+    at any zoom level. Column data can therefore be given at any granularity, down to single
+    trades given as bars with equal open, high, low, and close values. Bars from column data do
+    not emit the mouse interaction signals.
+
     \note The timestamps must be unique within a QCandlestickSeries. When using QBarCategoryAxis,
     only the first one of the candlestick items sharing a timestamp is drawn. If the chart includes
     multiple instances of QCandlestickSeries, items from different series sharing a timestamp are
@@ -453,6 +465,14 @@ QT_CHARTS_BEGIN_NAMESPACE
     \sa pen
 */
 
+/*!
+    \fn void QCandlestickSeries::columnDataChanged()
+    \since 5.11
+    This signal is emitted when the column data of the series changes.
+
+    \sa setColumnData()
+*/
+
 /*!
     \qmlmethod CandlestickSeries::at(int index)
     Returns the candlestick item at the position specified by \a index. Returns
@@ -653,6 +673,77 @@ int QCandlestickSeries::count() const
     return sets().count();
 }
 
+/*!
+    \since 5.11
+    Replaces the column data of the series with the bars given by \a timestamps, \a open,
+    \a high, \a low, and \a close. The arrays must be of the same size; otherwise, the column
+    data is not changed. The bars do not need to be sorted by timestamp.
+    Returns \c true if the data was set, \c false otherwise.
+
+    Column data is drawn in addition to the candlestick items of the series.
+    \sa appendColumnData(), clearColumnData()
+*/
+bool QCandlestickSeries::setColumnData(const QVector<qreal> &timestamps,
+                                       const QVector<qreal> &open, const QVector<qreal> &high,
+                                       const QVector<qreal> &low, const QVector<qreal> &close)
+{
+    Q_D(QCandlestickSeries);
+
+    if (!d->m_columns.set(timestamps, open, high, low, close))
+        return false;
+    d->m_pyramid.invalidate();
+
+    emit columnDataChanged();
+
+    return true;
+}
+
+/*!
+    \since 5.11
+    Adds a bar with the values \a timestamp, \a open, \a high, \a low, and \a close to the
+    column data of the series. Appending bars in timestamp order is fastest.
+    \sa setColumnData()
+*/
+void QCandlestickSeries::appendColumnData(qreal timestamp, qreal open, qreal high, qreal low,
+                                          qreal close)
+{
+    Q_D(QCandlestickSeries);
+
+    const bool atEnd = d->m_columns.isEmpty() || timestamp >= d->m_columns.timestamps().last();
+    d->m_columns.append(timestamp, open, high, low, close);
+    d->m_pyramid.append(d->m_columns, atEnd);
+    emit columnDataChanged();
+}
+
+/*!
+    \since 5.11
+    Removes all column data from the series.
+    \sa setColumnData()
+*/
+void QCandlestickSeries::clearColumnData()
+{
+    Q_D(QCandlestickSeries);
+
+    if (d->m_columns.isEmpty())
+        return;
+
+    d->m_columns.clear();
+    d->m_pyramid.invalidate();
+    emit columnDataChanged();
+}
+
+/*!
+    \since 5.11
+    Returns the number of bars in the column data of the series.
+    \sa setColumnData()
+*/
+int QCandlestickSeries::columnDataCount() const
+{
+    Q_D(const QCandlestickSeries);
+
+    return d->m_columns.count();
+}
+
 /*!
     Returns the type of the series (QAbstractSeries::SeriesTypeCandlestick).
 */
@@ -958,6 +1049,24 @@ void QCandlestickSeriesPrivate::initializeDomain()
         maxX = maxX + extra;
     }
 
+    if (!m_columns.isEmpty()) {
+        // Leave room for half a bar on both sides, like for the candlestick items.
+        const qreal extra = m_columns.timePeriod() / 2.0;
+        const qreal columnsMinX = m_columns.timestamps().first() - extra;
+        const qreal columnsMaxX = m_columns.timestamps().last() + extra;
+        if (m_sets.count()) {
+            minX = qMin(minX, columnsMinX);
+            maxX = qMax(maxX, columnsMaxX);
+            minY = qMin(minY, m_columns.minY());
+            maxY = qMax(maxY, m_columns.maxY());
+        } else {
+            minX = columnsMinX;
+            maxX = columnsMaxX;
+            minY = m_columns.minY();
+            maxY = m_columns.maxY();
+        }
+    }
+
     domain()->setRange(minX, maxX, minY, maxY);
 }
 
@@ -1060,13 +1169,18 @@ QAbstractAxis* QCandlestickSeriesPrivate::createDefaultAxis(Qt::Orientation orie
 
 bool QCandlestickSeriesPrivate::append(const QList<QCandlestickSet *> &sets)
 {
+    QSet<QCandlestickSet *> uniqueSets;
+    uniqueSets.reserve(sets.count());
     foreach (QCandlestickSet *set, sets) {
-        if ((set == 0) || m_sets.contains(set) || set->d_ptr->m_series)
+        // A set in this series has it as its series, so the series check covers m_sets.
+        if ((set == 0) || set->d_ptr->m_series)
             return false; // Fail if any of the sets is null or is already appended.
-        if (sets.count(set) != 1)
-            return false; // Also fail if the same set occurs more than once in the given list.
+        uniqueSets.insert(set);
     }
+    if (uniqueSets.count() != sets.count())
+        return false; // Also fail if the same set occurs more than once in the given list.
 
+    m_sets.reserve(m_sets.count() + sets.count());
     foreach (QCandlestickSet *set, sets) {
         m_sets.append(set);
         connect(set->d_func(), SIGNAL(updatedLayout()), this, SIGNAL(updatedLayout()));
@@ -1082,16 +1196,30 @@ bool QCandlestickSeriesPrivate::remove(const QList<QCandlestickSet *> &sets)
     if (sets.count() == 0)
         return false;
 
+    QSet<QCandlestickSet *> uniqueSets;
+    uniqueSets.reserve(sets.count());
     foreach (QCandlestickSet *set, sets) {
-        if ((set == 0) || (!m_sets.contains(set)))
+        if ((set == 0) || (set->d_ptr->m_series != this))
             return false; // Fail if any of the sets is null or is not in series.
-        if (sets.count(set) != 1)
-            return false; // Also fail if the same set occurs more than once in the given list.
+        uniqueSets.insert(set);
+    }
+    if (uniqueSets.count() != sets.count())
+        return false; // Also fail if the same set occurs more than once in the given list.
+
+    if (sets.count() == 1) {
+        m_sets.removeOne(sets.first());
+    } else {
+        QList<QCandlestickSet *> remaining;
+        remaining.reserve(m_sets.count() - sets.count());
+        foreach (QCandlestickSet *set, m_sets) {
+            if (!uniqueSets.contains(set))
+                remaining.append(set);
+        }
+        m_sets = remaining;
     }
 
     foreach (QCandlestickSet *set, sets) {
         set->d_ptr->m_series = nullptr;
-        m_sets.removeOne(set);
         disconnect(set->d_func(), SIGNAL(updatedLayout()), this, SIGNAL(updatedLayout()));
         disconnect(set->d_func(), SIGNAL(updatedCandlestick()),this, SIGNAL(updatedCandlesticks()));
     }
@@ -1112,6 +1240,13 @@ bool QCandlestickSeriesPrivate::insert(int index, QCandlestickSet *set)
     return true;
 }
 
+// Returns the resampling pyramid of the column data, building it if needed.
+const CandlestickPyramid &QCandlestickSeriesPrivate::columnPyramid()
+{
+    m_pyramid.update(m_columns);
+    return m_pyramid;
+}
+
 void QCandlestickSeriesPrivate::handleSeriesChange(QAbstractSeries *series)
 {
     Q_UNUSED(series);
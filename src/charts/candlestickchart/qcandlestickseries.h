@@ -67,6 +67,13 @@ public:
     QList<QCandlestickSet *> sets() const;
     int count() const;
 
+    bool setColumnData(const QVector<qreal> &timestamps, const QVector<qreal> &open,
+                       const QVector<qreal> &high, const QVector<qreal> &low,
+                       const QVector<qreal> &close);
+    void appendColumnData(qreal timestamp, qreal open, qreal high, qreal low, qreal close);
+    void clearColumnData();
+    int columnDataCount() const;
+
     QAbstractSeries::SeriesType type() const;
 
     void setMaximumColumnWidth(qreal maximumColumnWidth);
@@ -118,6 +125,7 @@ Q_SIGNALS:
     void decreasingColorChanged();
     void brushChanged();
     void penChanged();
+    void columnDataChanged();
 
 private:
     Q_DISABLE_COPY(QCandlestickSeries)
@@ -39,6 +39,8 @@
 #ifndef QCANDLESTICKSERIES_P_H
 #define QCANDLESTICKSERIES_P_H
 
+#include <private/candlestickcolumns_p.h>
+#include <private/candlestickpyramid_p.h>
 #include <private/qabstractseries_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
 
@@ -73,6 +75,9 @@ public:
     bool remove(const QList<QCandlestickSet *> &sets);
     bool insert(int index, QCandlestickSet *set);
 
+    const CandlestickColumns &columns() const { return m_columns; }
+    const CandlestickPyramid &columnPyramid();
+
 Q_SIGNALS:
     void clicked(int index, QCandlestickSet *set);
     void pressed(int index, QCandlestickSet *set);
@@ -91,6 +96,8 @@ private:
 
 protected:
     QList<QCandlestickSet *> m_sets;
+    CandlestickColumns m_columns;
+    CandlestickPyramid m_pyramid;
     qreal m_maximumColumnWidth;
     qreal m_minimumColumnWidth;
     qreal m_bodyWidth;
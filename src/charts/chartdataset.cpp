@@ -444,11 +444,17 @@ void ChartDataSet::zoomInDomain(const QRectF &rect)
         domains<<domain;
     }
 
+    ChartPresenter *presenter = m_chart ? m_chart->d_ptr->m_presenter : 0;
+    if (presenter)
+        presenter->beginGeometryBatch();
     foreach(AbstractDomain *domain, domains)
         domain->zoomIn(rect);
 
     foreach(AbstractDomain *domain, domains)
         domain->blockRangeSignals(false);
+
+    if (presenter)
+        presenter->endGeometryBatch();
 }
 
 void ChartDataSet::zoomOutDomain(const QRectF &rect)
@@ -460,11 +466,17 @@ void ChartDataSet::zoomOutDomain(const QRectF &rect)
         domains<<domain;
     }
 
+    ChartPresenter *presenter = m_chart ? m_chart->d_ptr->m_presenter : 0;
+    if (presenter)
+        presenter->beginGeometryBatch();
     foreach(AbstractDomain *domain, domains)
         domain->zoomOut(rect);
 
     foreach(AbstractDomain *domain, domains)
         domain->blockRangeSignals(false);
+
+    if (presenter)
+        presenter->endGeometryBatch();
 }
 
 void ChartDataSet::zoomResetDomain()
@@ -476,11 +488,17 @@ void ChartDataSet::zoomResetDomain()
         domains << domain;
     }
 
+    ChartPresenter *presenter = m_chart ? m_chart->d_ptr->m_presenter : 0;
+    if (presenter)
+        presenter->beginGeometryBatch();
     foreach (AbstractDomain *domain, domains)
         domain->zoomReset();
 
     foreach (AbstractDomain *domain, domains)
         domain->blockRangeSignals(false);
+
+    if (presenter)
+        presenter->endGeometryBatch();
 }
 
 bool ChartDataSet::isZoomedDomain()
@@ -501,11 +519,17 @@ void ChartDataSet::scrollDomain(qreal dx, qreal dy)
         domains<<domain;
     }
 
+    ChartPresenter *presenter = m_chart ? m_chart->d_ptr->m_presenter : 0;
+    if (presenter)
+        presenter->beginGeometryBatch();
     foreach(AbstractDomain *domain, domains)
         domain->move(dx, dy);
 
     foreach(AbstractDomain *domain, domains)
         domain->blockRangeSignals(false);
+
+    if (presenter)
+        presenter->endGeometryBatch();
 }
 
 QPointF ChartDataSet::mapToValue(const QPointF &position, QAbstractSeries *series)
@@ -41,7 +41,12 @@
 #include <private/cartesianchartlayout_p.h>
 #include <private/polarchartlayout_p.h>
 #include <private/charttitle_p.h>
+#include <private/xychart_p.h>
+#include <private/abstractdomain_p.h>
+#include <QtCore/QCache>
 #include <QtCore/QTimer>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtGui/QFontMetricsF>
 #include <QtGui/QTextDocument>
 #include <QtWidgets/QGraphicsScene>
 #include <QtWidgets/QGraphicsView>
@@ -54,6 +59,7 @@ ChartPresenter::ChartPresenter(QChart *chart, QChart::ChartType type)
       m_options(QChart::NoAnimation),
       m_animationDuration(ChartAnimationDuration),
       m_animationCurve(QEasingCurve::OutQuart),
+      m_animationPointLimit(-1),
       m_state(ShowState),
       m_background(0),
       m_plotAreaBackground(0),
@@ -63,6 +69,7 @@ ChartPresenter::ChartPresenter(QChart *chart, QChart::ChartType type)
       , m_glWidget(0)
       , m_glUseWidget(true)
 #endif
+      , m_geometryBatchLevel(0)
 {
     if (type == QChart::ChartTypeCartesian)
         m_layout = new CartesianChartLayout(this);
@@ -82,10 +89,12 @@ void ChartPresenter::setGeometry(const QRectF rect)
 {
     if (m_rect != rect) {
         m_rect = rect;
+        beginGeometryBatch();
         foreach (ChartItem *chart, m_chartItems) {
             chart->domain()->setSize(rect.size());
             chart->setPos(rect.topLeft());
         }
+        endGeometryBatch();
 #ifndef QT_NO_OPENGL
         if (!m_glWidget.isNull())
             m_glWidget->setGeometry(m_rect.toRect());
@@ -152,6 +161,7 @@ void ChartPresenter::handleSeriesRemoved(QAbstractSeries *series)
     if (chart->animation())
         chart->animation()->stopAndDestroyLater();
     m_chartItems.removeAll(chart);
+    m_deferredGeometryItems.removeAll(qobject_cast<XYChart *>(chart));
     m_series.removeAll(series);
     m_layout->invalidate();
 }
@@ -453,18 +463,135 @@ ChartTitle *ChartPresenter::titleElement()
     return m_title;
 }
 
-QRectF ChartPresenter::textBoundingRect(const QFont &font, const QString &text, qreal angle)
+namespace {
+
+struct TextKey
+{
+    QFont font;
+    QString text;
+
+    bool operator==(const TextKey &other) const
+    {
+        return text == other.text && font == other.font;
+    }
+};
+
+uint qHash(const TextKey &key, uint seed = 0)
+{
+    return qHash(key.text, seed) ^ qHash(key.font, seed);
+}
+
+// Number of unrotated text bounding rects kept in the cache of textBoundingRect().
+const int textBoundingRectCacheSize = 4096;
+
+struct TruncationKey
+{
+    QFont font;
+    QString text;
+    qreal angle;
+    qreal maxWidth;
+    qreal maxHeight;
+
+    bool operator==(const TruncationKey &other) const
+    {
+        return text == other.text && angle == other.angle && maxWidth == other.maxWidth
+                && maxHeight == other.maxHeight && font == other.font;
+    }
+};
+
+uint qHash(const TruncationKey &key, uint seed = 0)
+{
+    return qHash(key.text, seed) ^ qHash(key.font, seed) ^ qHash(key.angle, seed)
+            ^ qHash(key.maxWidth, seed) ^ qHash(key.maxHeight, seed);
+}
+
+struct Truncation
+{
+    QString text;
+    QRectF boundingRect;
+};
+
+// Number of truncation results kept in the cache of truncatedText().
+const int truncationCacheSize = 1024;
+
+quint64 textBoundingRectHits = 0;
+quint64 textBoundingRectMisses = 0;
+
+}
+
+QRectF ChartPresenter::richTextBoundingRect(const QFont &font, const QString &text)
 {
     static QGraphicsTextItem dummyTextItem;
     static bool initMargin = true;
     if (initMargin) {
-        dummyTextItem.document()->setDocumentMargin(textMargin());
+        dummyTextItem.document()->setDocumentMargin(ChartPresenter::textMargin());
         initMargin = false;
     }
 
     dummyTextItem.setFont(font);
     dummyTextItem.setHtml(text);
-    QRectF boundingRect = dummyTextItem.boundingRect();
+    return dummyTextItem.boundingRect();
+}
+
+// Returns true if text is laid out the same way as plain text and as rich text, which is the
+// case for a single line without markup, entities, or whitespace that rich text collapses.
+bool ChartPresenter::isPlainSingleLine(const QString &text)
+{
+    if (text.isEmpty())
+        return false;
+    bool previousSpace = true;
+    for (const QChar *c = text.constBegin(); c != text.constEnd(); ++c) {
+        if (*c == QLatin1Char(' ')) {
+            if (previousSpace)
+                return false;
+            previousSpace = true;
+        } else if (*c == QLatin1Char('<') || *c == QLatin1Char('&') || c->isSpace()
+                   || c->category() == QChar::Other_Control) {
+            return false;
+        } else {
+            previousSpace = false;
+        }
+    }
+    return !previousSpace;
+}
+
+// The bounding rect of a plain line of text differs from its advance only by the document
+// margins, which are the same for all text in a font. The difference and the line height are
+// measured once per font with the rich text item.
+QRectF ChartPresenter::plainTextBoundingRect(const QFont &font, const QString &text)
+{
+    static QHash<QFont, QSizeF> fontExtents;
+
+    const QFontMetricsF metrics(font);
+    QHash<QFont, QSizeF>::const_iterator extent = fontExtents.constFind(font);
+    if (extent == fontExtents.constEnd()) {
+        if (fontExtents.size() >= 64)
+            fontExtents.clear();
+        const QString reference(QStringLiteral("x"));
+        const QRectF rect = richTextBoundingRect(font, reference);
+        extent = fontExtents.insert(font, QSizeF(rect.width() - metrics.width(reference),
+                                                 rect.height()));
+    }
+    return QRectF(0, 0, metrics.width(text) + extent->width(), extent->height());
+}
+
+// The unrotated bounding rects are kept in a least recently used cache keyed by the font and the
+// text, as laying out the text is expensive and axes measure the same labels again and again.
+QRectF ChartPresenter::textBoundingRect(const QFont &font, const QString &text, qreal angle)
+{
+    static QCache<TextKey, QRectF> cache(textBoundingRectCacheSize);
+
+    const TextKey key = { font, text };
+    QRectF boundingRect;
+    if (const QRectF *cachedRect = cache.object(key)) {
+        textBoundingRectHits++;
+        boundingRect = *cachedRect;
+    } else {
+        textBoundingRectMisses++;
+        boundingRect = isPlainSingleLine(text) ? plainTextBoundingRect(font, text)
+                                               : richTextBoundingRect(font, text);
+        cache.insert(key, new QRectF(boundingRect));
+    }
 
     // Take rotation into account
     if (angle) {
@@ -476,19 +603,46 @@ QRectF ChartPresenter::textBoundingRect(const QFont &font, const QString &text,
     return boundingRect;
 }
 
+// Returns the number of textBoundingRect() calls that were answered from the cache.
+quint64 ChartPresenter::textBoundingRectCacheHits()
+{
+    return textBoundingRectHits;
+}
+
+// Returns the number of textBoundingRect() calls that had to lay out the text.
+quint64 ChartPresenter::textBoundingRectCacheMisses()
+{
+    return textBoundingRectMisses;
+}
+
+void ChartPresenter::resetTextBoundingRectCacheStatistics()
+{
+    textBoundingRectHits = 0;
+    textBoundingRectMisses = 0;
+}
+
 // boundingRect parameter returns the rotated bounding rect of the text
+// The results are memoized, so that relayouts truncate only labels that have changed.
 QString ChartPresenter::truncatedText(const QFont &font, const QString &text, qreal angle,
                                       qreal maxWidth, qreal maxHeight, QRectF &boundingRect)
 {
+    static QCache<TruncationKey, Truncation> cache(truncationCacheSize);
+
+    const TruncationKey key = { font, text, angle, maxWidth, maxHeight };
+    if (const Truncation *truncation = cache.object(key)) {
+        boundingRect = truncation->boundingRect;
+        return truncation->text;
+    }
+
     QString truncatedString(text);
     boundingRect = textBoundingRect(font, truncatedString, angle);
     if (boundingRect.width() > maxWidth || boundingRect.height() > maxHeight) {
         // It can be assumed that almost any amount of string manipulation is faster
-        // than calculating one bounding rectangle, so first prepare a list of truncated strings
-        // to try.
+        // than calculating one bounding rectangle, so first prepare a list of the lengths of
+        // the truncated strings to try. Only the strings that are measured are created.
         static QRegExp truncateMatcher(QStringLiteral("&#?[0-9a-zA-Z]*;$"));
 
-        QVector<QString> testStrings(text.length());
+        QVector<int> testLengths(text.length());
         int count(0);
         static QLatin1Char closeTag('>');
         static QLatin1Char openTag('<');
@@ -507,7 +661,7 @@ QString ChartPresenter::truncatedText(const QFont &font, const QString &text, qr
             if (chopIndex != -1)
                 chopCount = truncatedString.length() - chopIndex;
             truncatedString.chop(chopCount);
-            testStrings[count] = truncatedString + ellipsis;
+            testLengths[count] = truncatedString.length();
             count++;
         }
 
@@ -515,11 +669,13 @@ QString ChartPresenter::truncatedText(const QFont &font, const QString &text, qr
         int minIndex(0);
         int maxIndex(count - 1);
         int bestIndex(count);
+        QString bestString;
         QRectF checkRect;
 
         while (maxIndex >= minIndex) {
             int mid = (maxIndex + minIndex) / 2;
-            checkRect = textBoundingRect(font, testStrings.at(mid), angle);
+            const QString testString = text.left(testLengths.at(mid)) + ellipsis;
+            checkRect = textBoundingRect(font, testString, angle);
             if (checkRect.width() > maxWidth || checkRect.height() > maxHeight) {
                 // Checked index too large, all under this are also too large
                 minIndex = mid + 1;
@@ -527,6 +683,7 @@ QString ChartPresenter::truncatedText(const QFont &font, const QString &text, qr
                 // Checked index fits, all over this also fit
                 maxIndex = mid - 1;
                 bestIndex = mid;
+                bestString = testString;
                 boundingRect = checkRect;
             }
         }
@@ -535,10 +692,14 @@ QString ChartPresenter::truncatedText(const QFont &font, const QString &text, qr
             boundingRect = textBoundingRect(font, ellipsis, angle);
             truncatedString = ellipsis;
         } else {
-            truncatedString = testStrings.at(bestIndex);
+            truncatedString = bestString;
         }
     }
 
+    Truncation *truncation = new Truncation;
+    truncation->text = truncatedString;
+    truncation->boundingRect = boundingRect;
+    cache.insert(key, truncation);
     return truncatedString;
 }
 
@@ -586,6 +747,77 @@ void ChartPresenter::updateGLWidget()
 #endif
 }
 
+namespace {
+
+// Below this many points in total, mapping the deferred series on the calling thread is
+// cheaper than dispatching them to the thread pool.
+const int parallelGeometryThreshold = 100000;
+
+struct GeometryJob
+{
+    const AbstractDomain *domain;
+    XYSeriesColumns columns;
+    int offset;
+    QVector<QPointF> geometryPoints;
+};
+
+void calculateGeometryJob(GeometryJob &job)
+{
+    job.geometryPoints = job.domain->calculateColumnGeometryPoints(job.columns);
+}
+
+}
+
+// Domain updates of XY series are collected between beginGeometryBatch() and
+// endGeometryBatch() calls, so that the geometry of all affected series can be calculated
+// concurrently. Batches can be nested; the geometry is calculated when the outermost batch ends.
+void ChartPresenter::beginGeometryBatch()
+{
+    m_geometryBatchLevel++;
+}
+
+void ChartPresenter::endGeometryBatch()
+{
+    Q_ASSERT(m_geometryBatchLevel > 0);
+    if (--m_geometryBatchLevel > 0 || m_deferredGeometryItems.isEmpty())
+        return;
+
+    const QList<XYChart *> items = m_deferredGeometryItems;
+    m_deferredGeometryItems.clear();
+
+    QVector<GeometryJob> jobs(items.size());
+    int pointCount = 0;
+    for (int i = 0; i < items.size(); i++) {
+        XYChart *item = items.at(i);
+        jobs[i].domain = item->domain();
+        jobs[i].columns = item->geometryColumns(jobs[i].offset);
+        pointCount += jobs[i].columns.count();
+    }
+
+    // Domains are not modified while the jobs run, and the series data is shared with
+    // the jobs, so the geometry can be calculated outside the GUI thread.
+    if (jobs.size() > 1 && pointCount >= parallelGeometryThreshold) {
+        QtConcurrent::blockingMap(jobs, calculateGeometryJob);
+    } else {
+        for (int i = 0; i < jobs.size(); i++)
+            calculateGeometryJob(jobs[i]);
+    }
+
+    // The results are applied to the items on the GUI thread in one go.
+    for (int i = 0; i < items.size(); i++)
+        items.at(i)->applyGeometryPoints(jobs[i].geometryPoints, jobs[i].offset);
+}
+
+// Returns true if the geometry update of the item was deferred to the end of the current batch.
+bool ChartPresenter::deferGeometryUpdate(XYChart *item)
+{
+    if (!m_geometryBatchLevel)
+        return false;
+    if (!m_deferredGeometryItems.contains(item))
+        m_deferredGeometryItems.append(item);
+    return true;
+}
+
 #include "moc_chartpresenter_p.cpp"
 
 QT_CHARTS_END_NAMESPACE
@@ -62,6 +62,7 @@ class ChartBackground;
 class ChartTitle;
 class ChartAnimation;
 class AbstractChartLayout;
+class XYChart;
 
 class QT_CHARTS_PRIVATE_EXPORT ChartPresenter: public QObject
 {
@@ -157,6 +158,8 @@ public:
     int animationDuration() const { return m_animationDuration; }
     void setAnimationEasingCurve(const QEasingCurve &curve);
     QEasingCurve animationEasingCurve() const { return m_animationCurve; }
+    void setAnimationPointLimit(int count) { m_animationPointLimit = count; }
+    int animationPointLimit() const { return m_animationPointLimit; }
 
     void startAnimation(ChartAnimation *animation);
 
@@ -169,6 +172,12 @@ public:
     QChart *chart() { return m_chart; }
 
     static QRectF textBoundingRect(const QFont &font, const QString &text, qreal angle = 0.0);
+    static quint64 textBoundingRectCacheHits();
+    static quint64 textBoundingRectCacheMisses();
+    static void resetTextBoundingRectCacheStatistics();
+    static QRectF richTextBoundingRect(const QFont &font, const QString &text);
+    static QRectF plainTextBoundingRect(const QFont &font, const QString &text);
+    static bool isPlainSingleLine(const QString &text);
     static QString truncatedText(const QFont &font, const QString &text, qreal angle,
                                  qreal maxWidth, qreal maxHeight, QRectF &boundingRect);
     inline static qreal textMargin() { return qreal(0.5); }
@@ -179,6 +188,10 @@ public:
     void updateGLWidget();
     void glSetUseWidget(bool enable) { m_glUseWidget = enable; }
 
+    void beginGeometryBatch();
+    void endGeometryBatch();
+    bool deferGeometryUpdate(XYChart *item);
+
 private:
     void createBackgroundItem();
     void createPlotAreaBackgroundItem();
@@ -202,6 +215,7 @@ private:
     QChart::AnimationOptions m_options;
     int m_animationDuration;
     QEasingCurve m_animationCurve;
+    int m_animationPointLimit;
     State m_state;
     QPointF m_statePoint;
     AbstractChartLayout *m_layout;
@@ -215,6 +229,8 @@ private:
     QPointer<GLWidget> m_glWidget;
 #endif
     bool m_glUseWidget;
+    int m_geometryBatchLevel;
+    QList<XYChart *> m_deferredGeometryItems;
 };
 
 QT_CHARTS_END_NAMESPACE
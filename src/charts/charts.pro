@@ -3,6 +3,8 @@
 TARGET = QtCharts
 
 QT = core gui widgets
+QT_PRIVATE += core-private concurrent
+CONFIG += simd
 contains(QT_COORD_TYPE, float): DEFINES += QT_QREAL_IS_FLOAT
 
 QMAKE_DOCS = $$PWD/doc/qtcharts.qdocconf
@@ -29,6 +29,7 @@
 
 #include <private/abstractdomain_p.h>
 #include <private/qabstractaxis_p.h>
+#include <private/xyseriescolumns_p.h>
 #include <QtCore/QtMath>
 #include <cmath>
 
@@ -140,6 +141,13 @@ void AbstractDomain::handleReverseYChanged(bool reverse)
     emit updated();
 }
 
+// Maps series values stored in columns. Domains that cannot read the columns directly map
+// a copy of the values as points.
+QVector<QPointF> AbstractDomain::calculateColumnGeometryPoints(const XYSeriesColumns &columns) const
+{
+    return calculateGeometryPoints(columns.toPoints());
+}
+
 void AbstractDomain::blockRangeSignals(bool block)
 {
     if (m_signalsBlocked!=block) {
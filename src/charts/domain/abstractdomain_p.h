@@ -47,6 +47,7 @@
 QT_CHARTS_BEGIN_NAMESPACE
 
 class QAbstractAxis;
+class XYSeriesColumns;
 
 class QT_CHARTS_PRIVATE_EXPORT AbstractDomain: public QObject
 {
@@ -105,6 +106,7 @@ public:
     virtual QPointF calculateGeometryPoint(const QPointF &point, bool &ok) const = 0;
     virtual QPointF calculateDomainPoint(const QPointF &point) const = 0;
     virtual QVector<QPointF> calculateGeometryPoints(const QVector<QPointF> &vector) const = 0;
+    virtual QVector<QPointF> calculateColumnGeometryPoints(const XYSeriesColumns &columns) const;
 
     virtual bool attachAxis(QAbstractAxis *axis);
     virtual bool detachAxis(QAbstractAxis *axis);
@@ -12,7 +12,10 @@ SOURCES += \
     $$PWD/logxydomain.cpp \
     $$PWD/logxypolardomain.cpp \
     $$PWD/logxlogydomain.cpp \
-    $$PWD/logxlogypolardomain.cpp
+    $$PWD/logxlogypolardomain.cpp \
+    $$PWD/domaintransform.cpp
+
+AVX_SOURCES += $$PWD/domaintransform_avx.cpp
 
 PRIVATE_HEADERS += \
     $$PWD/abstractdomain_p.h \
@@ -24,4 +27,5 @@ PRIVATE_HEADERS += \
     $$PWD/logxydomain_p.h \
     $$PWD/logxypolardomain_p.h \
     $$PWD/logxlogydomain_p.h \
-    $$PWD/logxlogypolardomain_p.h
+    $$PWD/logxlogypolardomain_p.h \
+    $$PWD/domaintransform_p.h
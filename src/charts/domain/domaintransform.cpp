@@ -0,0 +1,200 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/domaintransform_p.h>
+#include <private/xyseriescolumns_p.h>
+#include <QtCore/private/qsimd_p.h>
+#include <cmath>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+#if defined(__SSE2__) && defined(QT_COMPILER_SUPPORTS_AVX) && !defined(QT_QREAL_IS_FLOAT)
+bool mapAffine_avx(const QPointF *source, QPointF *target, int count,
+                   qreal originX, qreal scaleX, qreal offsetX,
+                   qreal originY, qreal scaleY, qreal offsetY);
+#endif
+
+DomainTransform::DomainTransform()
+    : m_originX(0.0),
+      m_scaleX(1.0),
+      m_offsetX(0.0),
+      m_originY(0.0),
+      m_scaleY(1.0),
+      m_offsetY(0.0),
+      m_logBaseX(0.0),
+      m_logBaseY(0.0)
+{
+}
+
+// Maps x to (x - min) * delta, mirrored inside width if reverse is set.
+// If logBase is given, x is replaced by its logarithm in that base.
+// The minimum is subtracted before scaling, as in calculateGeometryPoint() of the domains,
+// so that large minimums, such as timestamps in milliseconds, don't cancel out the
+// fraction of the value that is inside the range.
+void DomainTransform::setX(qreal min, qreal delta, qreal width, bool reverse, qreal logBase)
+{
+    m_logBaseX = logBase > 0.0 ? std::log10(logBase) : 0.0;
+    m_originX = min;
+    m_scaleX = reverse ? -delta : delta;
+    m_offsetX = reverse ? width : 0.0;
+}
+
+// Maps y to height - (y - min) * delta, as the y-axis of the geometry grows downwards.
+// The mirroring is skipped if reverse is set.
+void DomainTransform::setY(qreal min, qreal delta, qreal height, bool reverse, qreal logBase)
+{
+    m_logBaseY = logBase > 0.0 ? std::log10(logBase) : 0.0;
+    m_originY = min;
+    m_scaleY = reverse ? delta : -delta;
+    m_offsetY = reverse ? 0.0 : height;
+}
+
+// Replaces the coordinates by log10(value) / logBase, where logBase is log10 of the base.
+template <bool logX, bool logY>
+static bool mapLogarithms(const QPointF *source, QPointF *target, int count,
+                          qreal logBaseX, qreal logBaseY)
+{
+    for (int i = 0; i < count; ++i) {
+        const qreal x = source[i].x();
+        const qreal y = source[i].y();
+        // Written so that NaN is rejected as well.
+        if ((logX && !(x > 0)) || (logY && !(y > 0)))
+            return false;
+        target[i].setX(logX ? std::log10(x) / logBaseX : x);
+        target[i].setY(logY ? std::log10(y) / logBaseY : y);
+    }
+    return true;
+}
+
+// Maps all points of source into target. Returns false if a logarithmic coordinate is not
+// positive, in which case the content of target is undefined, or if a mapped coordinate is NaN
+// or infinite, in which case target still holds all the mapped points.
+bool DomainTransform::map(const QVector<QPointF> &source, QVector<QPointF> &target) const
+{
+    const int count = source.count();
+    target.resize(count);
+    if (count == 0)
+        return true;
+
+    const QPointF *input = source.constData();
+    QPointF *output = target.data();
+
+    if (m_logBaseX > 0.0 || m_logBaseY > 0.0) {
+        bool valid;
+        if (m_logBaseX > 0.0 && m_logBaseY > 0.0)
+            valid = mapLogarithms<true, true>(input, output, count, m_logBaseX, m_logBaseY);
+        else if (m_logBaseX > 0.0)
+            valid = mapLogarithms<true, false>(input, output, count, m_logBaseX, m_logBaseY);
+        else
+            valid = mapLogarithms<false, true>(input, output, count, m_logBaseX, m_logBaseY);
+        if (!valid)
+            return false;
+        input = output;
+    }
+
+    return mapAffine(input, output, count, m_originX, m_scaleX, m_offsetX,
+                     m_originY, m_scaleY, m_offsetY);
+}
+
+// Maps the values of the columns into target, see above. The columns are gathered into
+// target first, so that the same kernels can be used for the mapping.
+bool DomainTransform::map(const XYSeriesColumns &source, QVector<QPointF> &target) const
+{
+    if (source.isPointArray())
+        return map(source.points(), target);
+
+    const int count = source.count();
+    target.resize(count);
+    if (count == 0)
+        return true;
+
+    source.copyPoints(target.data());
+    return mapInPlace(target.data(), count);
+}
+
+bool DomainTransform::mapInPlace(QPointF *points, int count) const
+{
+    if (m_logBaseX > 0.0 || m_logBaseY > 0.0) {
+        bool valid;
+        if (m_logBaseX > 0.0 && m_logBaseY > 0.0)
+            valid = mapLogarithms<true, true>(points, points, count, m_logBaseX, m_logBaseY);
+        else if (m_logBaseX > 0.0)
+            valid = mapLogarithms<true, false>(points, points, count, m_logBaseX, m_logBaseY);
+        else
+            valid = mapLogarithms<false, true>(points, points, count, m_logBaseX, m_logBaseY);
+        if (!valid)
+            return false;
+    }
+    return mapAffine(points, points, count, m_originX, m_scaleX, m_offsetX,
+                     m_originY, m_scaleY, m_offsetY);
+}
+
+// Applies (x - originX) * scaleX + offsetX and (y - originY) * scaleY + offsetY to count points.
+// Source and target may be the same array. Returns false if any of the results is NaN or
+// infinite.
+bool DomainTransform::mapAffine(const QPointF *source, QPointF *target, int count,
+                                qreal originX, qreal scaleX, qreal offsetX,
+                                qreal originY, qreal scaleY, qreal offsetY)
+{
+#if defined(__SSE2__) && !defined(QT_QREAL_IS_FLOAT)
+#  if defined(QT_COMPILER_SUPPORTS_AVX)
+    if (qCpuHasFeature(AVX))
+        return mapAffine_avx(source, target, count, originX, scaleX, offsetX,
+                             originY, scaleY, offsetY);
+#  endif
+    // QPointF is a pair of doubles, so one point fills one SSE2 register.
+    const double *in = reinterpret_cast<const double *>(source);
+    double *out = reinterpret_cast<double *>(target);
+    const __m128d origin = _mm_set_pd(originY, originX);
+    const __m128d scale = _mm_set_pd(scaleY, scaleX);
+    const __m128d offset = _mm_set_pd(offsetY, offsetX);
+    // x - x is NaN for NaN and infinite x, and NaN sticks in the sum.
+    __m128d check = _mm_setzero_pd();
+    for (int i = 0; i < count; ++i) {
+        const __m128d mapped = _mm_add_pd(_mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(in + 2 * i), origin),
+                                                     scale), offset);
+        check = _mm_add_pd(check, _mm_sub_pd(mapped, mapped));
+        _mm_storeu_pd(out + 2 * i, mapped);
+    }
+    return _mm_movemask_pd(_mm_cmpunord_pd(check, check)) == 0;
+#else
+    // x - x is NaN for NaN and infinite x, and NaN sticks in the sum.
+    qreal check = 0.0;
+    for (int i = 0; i < count; ++i) {
+        const qreal x = (source[i].x() - originX) * scaleX + offsetX;
+        const qreal y = (source[i].y() - originY) * scaleY + offsetY;
+        check += (x - x) + (y - y);
+        target[i].setX(x);
+        target[i].setY(y);
+    }
+    return check == 0.0;
+#endif
+}
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,74 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/domaintransform_p.h>
+#include <QtCore/private/qsimd_p.h>
+
+#if defined(__SSE2__) && defined(QT_COMPILER_SUPPORTS_AVX) && !defined(QT_QREAL_IS_FLOAT)
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// AVX variant of DomainTransform::mapAffine(), mapping two points per iteration.
+bool mapAffine_avx(const QPointF *source, QPointF *target, int count,
+                   qreal originX, qreal scaleX, qreal offsetX,
+                   qreal originY, qreal scaleY, qreal offsetY)
+{
+    const double *in = reinterpret_cast<const double *>(source);
+    double *out = reinterpret_cast<double *>(target);
+    const __m256d origin = _mm256_set_pd(originY, originX, originY, originX);
+    const __m256d scale = _mm256_set_pd(scaleY, scaleX, scaleY, scaleX);
+    const __m256d offset = _mm256_set_pd(offsetY, offsetX, offsetY, offsetX);
+    __m256d check = _mm256_setzero_pd();
+
+    int i = 0;
+    for (; i + 1 < count; i += 2) {
+        const __m256d mapped = _mm256_add_pd(_mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(in + 2 * i),
+                                                                         origin),
+                                                           scale),
+                                             offset);
+        check = _mm256_add_pd(check, _mm256_sub_pd(mapped, mapped));
+        _mm256_storeu_pd(out + 2 * i, mapped);
+    }
+
+    __m128d tailCheck = _mm_add_pd(_mm256_castpd256_pd128(check),
+                                   _mm256_extractf128_pd(check, 1));
+    if (i < count) {
+        const __m128d mapped = _mm_add_pd(_mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(in + 2 * i),
+                                                                _mm256_castpd256_pd128(origin)),
+                                                     _mm256_castpd256_pd128(scale)),
+                                          _mm256_castpd256_pd128(offset));
+        tailCheck = _mm_add_pd(tailCheck, _mm_sub_pd(mapped, mapped));
+        _mm_storeu_pd(out + 2 * i, mapped);
+    }
+    return _mm_movemask_pd(_mm_cmpunord_pd(tailCheck, tailCheck)) == 0;
+}
+
+QT_CHARTS_END_NAMESPACE
+
+#endif
@@ -0,0 +1,86 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+
+#ifndef DOMAINTRANSFORM_P_H
+#define DOMAINTRANSFORM_P_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QPointF>
+#include <QtCore/QVector>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class XYSeriesColumns;
+
+// Maps series points to geometry points. The mapping of each coordinate is reduced to
+// an origin, a scale and an offset, so that the reversal and orientation branches are resolved
+// once instead of for every point. Logarithmic coordinates are mapped to their logarithms first.
+class QT_CHARTS_PRIVATE_EXPORT DomainTransform
+{
+public:
+    DomainTransform();
+
+    void setX(qreal min, qreal delta, qreal width, bool reverse, qreal logBase = 0.0);
+    void setY(qreal min, qreal delta, qreal height, bool reverse, qreal logBase = 0.0);
+
+    bool map(const QVector<QPointF> &source, QVector<QPointF> &target) const;
+    bool map(const XYSeriesColumns &source, QVector<QPointF> &target) const;
+
+    static bool mapAffine(const QPointF *source, QPointF *target, int count,
+                          qreal originX, qreal scaleX, qreal offsetX,
+                          qreal originY, qreal scaleY, qreal offsetY);
+
+private:
+    bool mapInPlace(QPointF *points, int count) const;
+
+    qreal m_originX;
+    qreal m_scaleX;
+    qreal m_offsetX;
+    qreal m_originY;
+    qreal m_scaleY;
+    qreal m_offsetY;
+    qreal m_logBaseX;
+    qreal m_logBaseY;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // DOMAINTRANSFORM_P_H
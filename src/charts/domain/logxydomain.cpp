@@ -29,6 +29,7 @@
 
 #include <private/logxydomain_p.h>
 #include <private/qabstractaxis_p.h>
+#include <private/domaintransform_p.h>
 #include <QtCharts/QLogValueAxis>
 #include <QtCore/QtMath>
 #include <cmath>
@@ -168,29 +169,31 @@ QPointF LogXYDomain::calculateGeometryPoint(const QPointF &point, bool &ok) cons
     return QPointF(x, y);
 }
 
-QVector<QPointF> LogXYDomain::calculateGeometryPoints(const QVector<QPointF> &vector) const
+DomainTransform LogXYDomain::geometryTransform() const
 {
-    const qreal deltaX = m_size.width() / (m_logRightX - m_logLeftX);
-    const qreal deltaY = m_size.height() / (m_maxY - m_minY);
+    DomainTransform transform;
+    transform.setX(m_logLeftX, m_size.width() / (m_logRightX - m_logLeftX), m_size.width(),
+                   m_reverseX, m_logBaseX);
+    transform.setY(m_minY, m_size.height() / (m_maxY - m_minY), m_size.height(), m_reverseY);
+    return transform;
+}
 
+QVector<QPointF> LogXYDomain::calculateGeometryPoints(const QVector<QPointF> &vector) const
+{
     QVector<QPointF> result;
-    result.resize(vector.count());
-
-    for (int i = 0; i < vector.count(); ++i) {
-        if (vector[i].x() > 0) {
-            qreal x = ((std::log10(vector[i].x()) / std::log10(m_logBaseX)) - m_logLeftX) * deltaX;
-            if (m_reverseX)
-                x = m_size.width() - x;
-            qreal y = (vector[i].y() - m_minY) * deltaY;
-            if (!m_reverseY)
-                y = m_size.height() - y;
-            result[i].setX(x);
-            result[i].setY(y);
-        } else {
-            qWarning() << "Logarithms of zero and negative values are undefined.";
-            return QVector<QPointF>();
-        }
+    if (!geometryTransform().map(vector, result)) {
+        qWarning() << "Logarithms of zero and negative values are undefined.";
+        return QVector<QPointF>();
+    }
+    return result;
+}
 
+QVector<QPointF> LogXYDomain::calculateColumnGeometryPoints(const XYSeriesColumns &columns) const
+{
+    QVector<QPointF> result;
+    if (!geometryTransform().map(columns, result)) {
+        qWarning() << "Logarithms of zero and negative values are undefined.";
+        return QVector<QPointF>();
     }
     return result;
 }
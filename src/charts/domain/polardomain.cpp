@@ -29,6 +29,7 @@
 
 #include <private/polardomain_p.h>
 #include <private/qabstractaxis_p.h>
+#include <private/xyseriescolumns_p.h>
 #include <QtCore/QtMath>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -87,6 +88,33 @@ QVector<QPointF> PolarDomain::calculateGeometryPoints(const QVector<QPointF> &ve
     return result;
 }
 
+// Returns the angular coordinates of the x values of columns. Values that have no angular
+// coordinate are mapped to zero.
+QVector<qreal> PolarDomain::toAngularCoordinates(const XYSeriesColumns &columns) const
+{
+    QVector<qreal> result(columns.count());
+    const XYSeriesColumns::Column &x = columns.x();
+    qreal *angles = result.data();
+    bool ok;
+    for (int i = 0; i < columns.count(); ++i)
+        angles[i] = toAngularCoordinate(x.at(i), ok);
+    return result;
+}
+
+// Implements toAngularCoordinates() for domains with a linear angular axis. The expression is
+// the one of their toAngularCoordinate(), so that the angles are exactly the same; the line
+// item compares them to 0 and 360 degrees.
+QVector<qreal> PolarDomain::toLinearAngularCoordinates(const XYSeriesColumns &columns) const
+{
+    QVector<qreal> result(columns.count());
+    const XYSeriesColumns::Column &x = columns.x();
+    const qreal range = m_maxX - m_minX;
+    qreal *angles = result.data();
+    for (int i = 0; i < columns.count(); ++i)
+        angles[i] = (x.at(i) - m_minX) / range * 360.0;
+    return result;
+}
+
 QPointF PolarDomain::polarCoordinateToPoint(qreal angularCoordinate, qreal radialCoordinate) const
 {
     qreal dx = qSin(qDegreesToRadians(angularCoordinate)) * radialCoordinate;
@@ -59,9 +59,11 @@ public:
 
     virtual qreal toAngularCoordinate(qreal value, bool &ok) const = 0;
     virtual qreal toRadialCoordinate(qreal value, bool &ok) const = 0;
+    virtual QVector<qreal> toAngularCoordinates(const XYSeriesColumns &columns) const;
 
 protected:
     QPointF polarCoordinateToPoint(qreal angularCoordinate, qreal radialCoordinate) const;
+    QVector<qreal> toLinearAngularCoordinates(const XYSeriesColumns &columns) const;
 
     QPointF m_center;
     qreal m_radius;
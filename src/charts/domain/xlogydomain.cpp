@@ -29,6 +29,7 @@
 
 #include <private/xlogydomain_p.h>
 #include <private/qabstractaxis_p.h>
+#include <private/domaintransform_p.h>
 #include <QtCharts/QLogValueAxis>
 #include <QtCore/QtMath>
 #include <cmath>
@@ -168,28 +169,31 @@ QPointF XLogYDomain::calculateGeometryPoint(const QPointF &point, bool &ok) cons
     return QPointF(x, y);
 }
 
+DomainTransform XLogYDomain::geometryTransform() const
+{
+    DomainTransform transform;
+    transform.setX(m_minX, m_size.width() / (m_maxX - m_minX), m_size.width(), m_reverseX);
+    transform.setY(m_logLeftY, m_size.height() / qAbs(m_logRightY - m_logLeftY), m_size.height(),
+                   m_reverseY, m_logBaseY);
+    return transform;
+}
+
 QVector<QPointF> XLogYDomain::calculateGeometryPoints(const QVector<QPointF> &vector) const
 {
-    const qreal deltaX = m_size.width() / (m_maxX - m_minX);
-    const qreal deltaY = m_size.height() / qAbs(m_logRightY - m_logLeftY);
+    QVector<QPointF> result;
+    if (!geometryTransform().map(vector, result)) {
+        qWarning() << "Logarithms of zero and negative values are undefined.";
+        return QVector<QPointF>();
+    }
+    return result;
+}
 
+QVector<QPointF> XLogYDomain::calculateColumnGeometryPoints(const XYSeriesColumns &columns) const
+{
     QVector<QPointF> result;
-    result.resize(vector.count());
-
-    for (int i = 0; i < vector.count(); ++i) {
-        if (vector[i].y() > 0) {
-            qreal x = (vector[i].x() - m_minX) * deltaX;
-            if (m_reverseX)
-                x = m_size.width() - x;
-            qreal y = ((std::log10(vector[i].y()) / std::log10(m_logBaseY)) - m_logLeftY) * deltaY;
-            if (!m_reverseY)
-                y = m_size.height() - y;
-            result[i].setX(x);
-            result[i].setY(y);
-        } else {
-            qWarning() << "Logarithms of zero and negative values are undefined.";
-            return QVector<QPointF>();
-        }
+    if (!geometryTransform().map(columns, result)) {
+        qWarning() << "Logarithms of zero and negative values are undefined.";
+        return QVector<QPointF>();
     }
     return result;
 }
@@ -45,6 +45,8 @@
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+class DomainTransform;
+
 class QT_CHARTS_PRIVATE_EXPORT XLogYDomain: public AbstractDomain
 {
     Q_OBJECT
@@ -67,6 +69,7 @@ public:
     QPointF calculateGeometryPoint(const QPointF &point, bool &ok) const;
     QPointF calculateDomainPoint(const QPointF &point) const;
     QVector<QPointF> calculateGeometryPoints(const QVector<QPointF> &vector) const;
+    QVector<QPointF> calculateColumnGeometryPoints(const XYSeriesColumns &columns) const;
 
     bool attachAxis(QAbstractAxis *axis);
     bool detachAxis(QAbstractAxis *axis);
@@ -75,6 +78,8 @@ public Q_SLOTS:
     void handleVerticalAxisBaseChanged(qreal baseY);
 
 private:
+    DomainTransform geometryTransform() const;
+
     qreal m_logLeftY;
     qreal m_logRightY;
     qreal m_logBaseY;
@@ -147,6 +147,11 @@ qreal XLogYPolarDomain::toAngularCoordinate(qreal value, bool &ok) const
     return f * 360.0;
 }
 
+QVector<qreal> XLogYPolarDomain::toAngularCoordinates(const XYSeriesColumns &columns) const
+{
+    return toLinearAngularCoordinates(columns);
+}
+
 qreal XLogYPolarDomain::toRadialCoordinate(qreal value, bool &ok) const
 {
     qreal retVal;
@@ -75,6 +75,7 @@ public Q_SLOTS:
 protected:
     qreal toAngularCoordinate(qreal value, bool &ok) const;
     qreal toRadialCoordinate(qreal value, bool &ok) const;
+    QVector<qreal> toAngularCoordinates(const XYSeriesColumns &columns) const;
 
 private:
     qreal m_logInnerY;
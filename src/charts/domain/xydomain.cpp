@@ -29,6 +29,7 @@
 
 #include <private/xydomain_p.h>
 #include <private/qabstractaxis_p.h>
+#include <private/domaintransform_p.h>
 #include <QtCore/QtMath>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -166,24 +167,27 @@ QPointF XYDomain::calculateGeometryPoint(const QPointF &point, bool &ok) const
     return QPointF(x, y);
 }
 
+DomainTransform XYDomain::geometryTransform() const
+{
+    DomainTransform transform;
+    transform.setX(m_minX, m_size.width() / (m_maxX - m_minX), m_size.width(), m_reverseX);
+    transform.setY(m_minY, m_size.height() / (m_maxY - m_minY), m_size.height(), m_reverseY);
+    return transform;
+}
+
+// Points that don't map to finite coordinates are kept as they are, so that only they are
+// skipped by the items instead of the whole series.
 QVector<QPointF> XYDomain::calculateGeometryPoints(const QVector<QPointF> &vector) const
 {
-    const qreal deltaX = m_size.width() / (m_maxX - m_minX);
-    const qreal deltaY = m_size.height() / (m_maxY - m_minY);
+    QVector<QPointF> result;
+    geometryTransform().map(vector, result);
+    return result;
+}
 
+QVector<QPointF> XYDomain::calculateColumnGeometryPoints(const XYSeriesColumns &columns) const
+{
     QVector<QPointF> result;
-    result.resize(vector.count());
-
-    for (int i = 0; i < vector.count(); ++i) {
-        qreal x = (vector[i].x() - m_minX) * deltaX;
-        if (m_reverseX)
-            x = m_size.width() - x;
-        qreal y = (vector[i].y() - m_minY) * deltaY;
-        if (!m_reverseY)
-            y = m_size.height() - y;
-        result[i].setX(x);
-        result[i].setY(y);
-    }
+    geometryTransform().map(columns, result);
     return result;
 }
 
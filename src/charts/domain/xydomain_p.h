@@ -45,6 +45,8 @@
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+class DomainTransform;
+
 class QT_CHARTS_PRIVATE_EXPORT XYDomain: public AbstractDomain
 {
     Q_OBJECT
@@ -67,6 +69,10 @@ public:
     QPointF calculateGeometryPoint(const QPointF &point, bool &ok) const;
     QPointF calculateDomainPoint(const QPointF &point) const;
     QVector<QPointF> calculateGeometryPoints(const QVector<QPointF> &vector) const;
+    QVector<QPointF> calculateColumnGeometryPoints(const XYSeriesColumns &columns) const;
+
+private:
+    DomainTransform geometryTransform() const;
 };
 
 QT_CHARTS_END_NAMESPACE
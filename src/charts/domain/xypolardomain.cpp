@@ -149,6 +149,11 @@ qreal XYPolarDomain::toAngularCoordinate(qreal value, bool &ok) const
     return f * 360.0;
 }
 
+QVector<qreal> XYPolarDomain::toAngularCoordinates(const XYSeriesColumns &columns) const
+{
+    return toLinearAngularCoordinates(columns);
+}
+
 qreal XYPolarDomain::toRadialCoordinate(qreal value, bool &ok) const
 {
     ok = true;
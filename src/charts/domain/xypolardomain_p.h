@@ -68,6 +68,7 @@ public:
 protected:
     qreal toAngularCoordinate(qreal value, bool &ok) const;
     qreal toRadialCoordinate(qreal value, bool &ok) const;
+    QVector<qreal> toAngularCoordinates(const XYSeriesColumns &columns) const;
 };
 
 QT_CHARTS_END_NAMESPACE
@@ -347,17 +347,16 @@ void GLWidget::render(bool selection)
             m_program->setUniformValue(m_minUniformLoc, data->min);
             m_program->setUniformValue(m_deltaUniformLoc, data->delta);
             m_program->setUniformValue(m_matrixUniformLoc, data->matrix);
-            bool dirty = data->dirty;
+            bool newBuffer = false;
             if (!vbo) {
                 vbo = new QOpenGLBuffer;
                 m_seriesBufferMap.insert(i.key(), vbo);
                 vbo->create();
-                dirty = true;
+                newBuffer = true;
             }
             vbo->bind();
-            if (dirty) {
-                vbo->allocate(data->array.constData(), data->array.count() * sizeof(GLfloat));
-                dirty = false;
+            if (newBuffer || data->dirty) {
+                data->upload(vbo, newBuffer);
                 m_selectionRenderNeeded = true;
             }
 
@@ -36,14 +36,88 @@
 #include <private/charttheme_p.h>
 #include <QtGui/QPainter>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
+#include <cmath>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// Records the subpaths of a path made of polylines and ellipses into flat arrays, and creates the
+// QPainterPath from them at once, so that long polylines are added with a single addPolygon() call.
+// Like QPainterPath, consecutive moveTo() calls replace each other and lineTo() skips duplicates.
+class PolylineRecorder
+{
+public:
+    PolylineRecorder() : m_open(false) {}
+
+    void moveTo(const QPointF &point)
+    {
+        if (m_open && m_runs.last().count == 1) {
+            m_points.last() = point;
+            return;
+        }
+        const Run run = { m_points.size(), 1, 0.0 };
+        m_runs.append(run);
+        m_points.append(point);
+        m_open = true;
+    }
+
+    void lineTo(const QPointF &point)
+    {
+        if (!m_open)
+            moveTo(m_points.isEmpty() ? QPointF() : m_points.last());
+        if (m_points.last() == point)
+            return;
+        m_points.append(point);
+        m_runs.last().count++;
+    }
+
+    void addEllipse(const QPointF &center, qreal radius)
+    {
+        // Ellipses are stored as runs without points.
+        const Run run = { m_points.size(), 0, radius };
+        m_runs.append(run);
+        m_points.append(center);
+        m_open = false;
+    }
+
+    QPainterPath toPath() const
+    {
+        QPainterPath path;
+        for (int i = 0; i < m_runs.size(); i++) {
+            const Run &run = m_runs.at(i);
+            if (run.count == 0) {
+                path.addEllipse(m_points.at(run.start), run.radius, run.radius);
+            } else if (run.count <= 2) {
+                path.moveTo(m_points.at(run.start));
+                if (run.count == 2)
+                    path.lineTo(m_points.at(run.start + 1));
+            } else {
+                path.addPolygon(QPolygonF(m_points.mid(run.start, run.count)));
+            }
+        }
+        return path;
+    }
+
+private:
+    struct Run
+    {
+        int start;
+        int count;
+        qreal radius;
+    };
+
+    QVector<QPointF> m_points;
+    QVector<Run> m_runs;
+    bool m_open;
+};
+
 LineChartItem::LineChartItem(QLineSeries *series, QGraphicsItem *item)
     : XYChart(series,item),
       m_series(series),
+      m_pathsDeferred(false),
+      m_shapeDirty(true),
       m_pointsVisible(false),
       m_chartType(QChart::ChartTypeUndefined),
+      m_decimationMode(series->decimationMode()),
       m_pointLabelsVisible(false),
       m_pointLabelsFormat(series->pointLabelsFormat()),
       m_pointLabelsFont(series->pointLabelsFont()),
@@ -54,6 +128,8 @@ LineChartItem::LineChartItem(QLineSeries *series, QGraphicsItem *item)
     setAcceptHoverEvents(true);
     setFlag(QGraphicsItem::ItemIsSelectable);
     setZValue(ChartPresenter::LineChartZValue);
+    // Straight segments only need the neighbors of the points in view.
+    setCullingMargin(1);
     QObject::connect(series->d_func(), SIGNAL(updated()), this, SLOT(handleUpdated()));
     QObject::connect(series, SIGNAL(visibleChanged()), this, SLOT(handleUpdated()));
     QObject::connect(series, SIGNAL(opacityChanged()), this, SLOT(handleUpdated()));
@@ -64,6 +140,8 @@ LineChartItem::LineChartItem(QLineSeries *series, QGraphicsItem *item)
     QObject::connect(series, SIGNAL(pointLabelsFontChanged(QFont)), this, SLOT(handleUpdated()));
     QObject::connect(series, SIGNAL(pointLabelsColorChanged(QColor)), this, SLOT(handleUpdated()));
     QObject::connect(series, SIGNAL(pointLabelsClippingChanged(bool)), this, SLOT(handleUpdated()));
+    QObject::connect(series, SIGNAL(decimationModeChanged(QLineSeries::DecimationMode)),
+                     this, SLOT(handleUpdated()));
     handleUpdated();
 }
 
@@ -72,11 +150,39 @@ QRectF LineChartItem::boundingRect() const
     return m_rect;
 }
 
+// Creating the stroke of a long line can be more expensive than creating the line itself, so
+// the stroke is only created when the scene needs it for hit testing, and kept until the
+// geometry changes.
 QPainterPath LineChartItem::shape() const
 {
+    if (!m_shapeDirty)
+        return m_shapePath;
+    createDeferredPaths();
+    m_shapePath = shapeStroker().createStroke(m_fullPath);
+    m_shapeDirty = false;
     return m_shapePath;
 }
 
+// Calculates the bounding rect of the points. Returns false if any of the points is not finite.
+static bool finiteBoundingRect(const QVector<QPointF> &points, QRectF &rect)
+{
+    qreal minX = points.at(0).x();
+    qreal maxX = minX;
+    qreal minY = points.at(0).y();
+    qreal maxY = minY;
+    for (int i = 0; i < points.size(); i++) {
+        const QPointF &point = points.at(i);
+        if (!qIsFinite(point.x()) || !qIsFinite(point.y()))
+            return false;
+        minX = qMin(minX, point.x());
+        maxX = qMax(maxX, point.x());
+        minY = qMin(minY, point.y());
+        maxY = qMax(maxY, point.y());
+    }
+    rect = QRectF(minX, minY, maxX - minX, maxY - minY);
+    return true;
+}
+
 void LineChartItem::updateGeometry()
 {
     if (m_series->useOpenGL()) {
@@ -89,41 +195,64 @@ void LineChartItem::updateGeometry()
         return;
     }
 
+    // Area series use component line series that aren't necessarily added to the chart themselves,
+    // so check if chart type is forced before trying to obtain it from the chart.
+    QChart::ChartType chartType = m_chartType;
+    if (chartType == QChart::ChartTypeUndefined)
+        chartType = m_series->chart()->chartType();
+
     // Store the points to a local variable so that the old line gets properly cleared
     // when animation starts.
-    m_linePoints = geometryPoints();
+    // Points and point labels are drawn for every point and polar charts need the series
+    // point for every geometry point, so decimation is only possible for plain cartesian lines.
+    if (m_decimationMode != QLineSeries::NoDecimation && chartType != QChart::ChartTypePolar
+        && !m_pointsVisible && !m_pointLabelsVisible) {
+        m_linePoints = decimatedPoints(geometryPoints());
+    } else {
+        m_linePoints = geometryPoints();
+    }
     const QVector<QPointF> &points = m_linePoints;
 
     if (points.size() == 0) {
         prepareGeometryChange();
         m_fullPath = QPainterPath();
         m_linePath = QPainterPath();
+        m_shapePath = QPainterPath();
+        m_shapeDirty = true;
+        m_pathsDeferred = false;
         m_rect = QRect();
         return;
     }
 
     QPainterPath linePath;
     QPainterPath fullPath;
+    QRectF pointsRect;
+    bool deferPaths = false;
     // Use worst case scenario to determine required margin.
     qreal margin = m_linePen.width() * 1.42;
 
-    // Area series use component line series that aren't necessarily added to the chart themselves,
-    // so check if chart type is forced before trying to obtain it from the chart.
-    QChart::ChartType chartType = m_chartType;
-    if (chartType == QChart::ChartTypeUndefined)
-        chartType = m_series->chart()->chartType();
-
     // For polar charts, we need special handling for angular (horizontal)
     // points that are off-grid.
     if (chartType == QChart::ChartTypePolar) {
-        QPainterPath linePathLeft;
-        QPainterPath linePathRight;
-        QPainterPath *currentSegmentPath = 0;
-        QPainterPath *previousSegmentPath = 0;
+        PolylineRecorder leftRecorder;
+        PolylineRecorder rightRecorder;
+        PolylineRecorder lineRecorder;
+        PolylineRecorder fullRecorder;
+        PolylineRecorder *currentSegmentPath = 0;
+        PolylineRecorder *previousSegmentPath = 0;
         qreal minX = domain()->minX();
         qreal maxX = domain()->maxX();
         qreal minY = domain()->minY();
-        QPointF currentSeriesPoint = m_series->at(0);
+        // The angular coordinates of all series points are calculated in one pass up front.
+        const XYSeriesColumns columns = m_series->d_func()->columns();
+        QVector<qreal> angles;
+        if (const PolarDomain *pd = qobject_cast<const PolarDomain *>(domain()))
+            angles = pd->toAngularCoordinates(columns);
+        else
+            qWarning() << Q_FUNC_INFO << "Unexpected domain: " << domain();
+        if (angles.size() != columns.count())
+            angles.fill(0.0, columns.count());
+        QPointF currentSeriesPoint = columns.at(0);
         QPointF currentGeometryPoint = points.at(0);
         QPointF previousGeometryPoint = points.at(0);
         int size = m_linePen.width();
@@ -134,13 +263,13 @@ void LineChartItem::updateGeometry()
         const QPointF centerPoint(domainRadius, domainRadius);
 
         if (!previousPointWasOffGrid) {
-            fullPath.moveTo(points.at(0));
+            fullRecorder.moveTo(points.at(0));
             if (m_pointsVisible && currentSeriesPoint.y() >= minY) {
                 // Do not draw ellipses for points below minimum Y.
-                linePath.addEllipse(points.at(0), size, size);
-                fullPath.addEllipse(points.at(0), size, size);
-                linePath.moveTo(points.at(0));
-                fullPath.moveTo(points.at(0));
+                lineRecorder.addEllipse(points.at(0), size);
+                fullRecorder.addEllipse(points.at(0), size);
+                lineRecorder.moveTo(points.at(0));
+                fullRecorder.moveTo(points.at(0));
             }
         }
 
@@ -149,7 +278,7 @@ void LineChartItem::updateGeometry()
         qreal horizontal = centerPoint.y();
 
         // See ScatterChartItem::updateGeometry() for explanation why seriesLastIndex is needed
-        const int seriesLastIndex = m_series->count() - 1;
+        const int seriesLastIndex = columns.count() - 1;
 
         for (int i = 1; i < points.size(); i++) {
             // Interpolating line fragments would be ugly when thick pen is used,
@@ -164,7 +293,8 @@ void LineChartItem::updateGeometry()
             // degrees and both of the points are within the margin, one in the top half and one in the
             // bottom half of the chart, the bottom one gets clipped incorrectly.
             // However, this should be rare occurrence in any sensible chart.
-            currentSeriesPoint = m_series->at(qMin(seriesLastIndex, i));
+            const int seriesIndex = qMin(seriesLastIndex, i);
+            currentSeriesPoint = columns.at(seriesIndex);
             currentGeometryPoint = points.at(i);
             pointOffGrid = (currentSeriesPoint.x() < minX || currentSeriesPoint.x() > maxX);
 
@@ -182,15 +312,8 @@ void LineChartItem::updateGeometry()
                     intersectionPoint = QPointF(centerPoint.x(), y);
                 }
 
-                bool dummyOk; // We know points are ok, but this is needed
-                qreal currentAngle = 0;
-                qreal previousAngle = 0;
-                if (const PolarDomain *pd = qobject_cast<const PolarDomain *>(domain())) {
-                    currentAngle = pd->toAngularCoordinate(currentSeriesPoint.x(), dummyOk);
-                    previousAngle = pd->toAngularCoordinate(m_series->at(i - 1).x(), dummyOk);
-                } else {
-                    qWarning() << Q_FUNC_INFO << "Unexpected domain: " << domain();
-                }
+                const qreal currentAngle = angles.at(seriesIndex);
+                const qreal previousAngle = angles.at(qMin(seriesLastIndex, i - 1));
                 if ((qAbs(currentAngle - previousAngle) > 180.0)) {
                     // If the angle between two points is over 180 degrees (half X range),
                     // any direct segment between them becomes meaningless.
@@ -198,12 +321,12 @@ void LineChartItem::updateGeometry()
                     // point to the center and from center to current point.
                     if ((previousAngle < 0.0 || (previousAngle <= 180.0 && previousGeometryPoint.x() < rightMarginLine))
                         && previousGeometryPoint.y() < horizontal) {
-                        currentSegmentPath = &linePathRight;
+                        currentSegmentPath = &rightRecorder;
                     } else if ((previousAngle > 360.0 || (previousAngle > 180.0 && previousGeometryPoint.x() > leftMarginLine))
                                 && previousGeometryPoint.y() < horizontal) {
-                        currentSegmentPath = &linePathLeft;
+                        currentSegmentPath = &leftRecorder;
                     } else if (previousAngle > 0.0 && previousAngle < 360.0) {
-                        currentSegmentPath = &linePath;
+                        currentSegmentPath = &lineRecorder;
                     } else {
                         currentSegmentPath = 0;
                     }
@@ -212,22 +335,22 @@ void LineChartItem::updateGeometry()
                         if (previousSegmentPath != currentSegmentPath)
                             currentSegmentPath->moveTo(previousGeometryPoint);
                         if (previousPointWasOffGrid)
-                            fullPath.moveTo(intersectionPoint);
+                            fullRecorder.moveTo(intersectionPoint);
 
                         currentSegmentPath->lineTo(centerPoint);
-                        fullPath.lineTo(centerPoint);
+                        fullRecorder.lineTo(centerPoint);
                     }
 
                     previousSegmentPath = currentSegmentPath;
 
                     if ((currentAngle < 0.0 || (currentAngle <= 180.0 && currentGeometryPoint.x() < rightMarginLine))
                         && currentGeometryPoint.y() < horizontal) {
-                        currentSegmentPath = &linePathRight;
+                        currentSegmentPath = &rightRecorder;
                     } else if ((currentAngle > 360.0 || (currentAngle > 180.0 &&currentGeometryPoint.x() > leftMarginLine))
                                 && currentGeometryPoint.y() < horizontal) {
-                        currentSegmentPath = &linePathLeft;
+                        currentSegmentPath = &leftRecorder;
                     } else if (currentAngle > 0.0 && currentAngle < 360.0) {
-                        currentSegmentPath = &linePath;
+                        currentSegmentPath = &lineRecorder;
                     } else {
                         currentSegmentPath = 0;
                     }
@@ -236,38 +359,38 @@ void LineChartItem::updateGeometry()
                         if (previousSegmentPath != currentSegmentPath)
                             currentSegmentPath->moveTo(centerPoint);
                         if (!previousSegmentPath)
-                            fullPath.moveTo(centerPoint);
+                            fullRecorder.moveTo(centerPoint);
 
                         currentSegmentPath->lineTo(currentGeometryPoint);
                         if (pointOffGrid)
-                            fullPath.lineTo(intersectionPoint);
+                            fullRecorder.lineTo(intersectionPoint);
                         else
-                            fullPath.lineTo(currentGeometryPoint);
+                            fullRecorder.lineTo(currentGeometryPoint);
                     }
                 } else {
                     if (previousAngle < 0.0 || currentAngle < 0.0
                         || ((previousAngle <= 180.0 && currentAngle <= 180.0)
                             && ((previousGeometryPoint.x() < rightMarginLine && previousGeometryPoint.y() < horizontal)
                                 || (currentGeometryPoint.x() < rightMarginLine && currentGeometryPoint.y() < horizontal)))) {
-                        currentSegmentPath = &linePathRight;
+                        currentSegmentPath = &rightRecorder;
                     } else if (previousAngle > 360.0 || currentAngle > 360.0
                                || ((previousAngle > 180.0 && currentAngle > 180.0)
                                    && ((previousGeometryPoint.x() > leftMarginLine && previousGeometryPoint.y() < horizontal)
                                        || (currentGeometryPoint.x() > leftMarginLine && currentGeometryPoint.y() < horizontal)))) {
-                        currentSegmentPath = &linePathLeft;
+                        currentSegmentPath = &leftRecorder;
                     } else {
-                        currentSegmentPath = &linePath;
+                        currentSegmentPath = &lineRecorder;
                     }
 
                     if (currentSegmentPath != previousSegmentPath)
                         currentSegmentPath->moveTo(previousGeometryPoint);
                     if (previousPointWasOffGrid)
-                        fullPath.moveTo(intersectionPoint);
+                        fullRecorder.moveTo(intersectionPoint);
 
                     if (pointOffGrid)
-                        fullPath.lineTo(intersectionPoint);
+                        fullRecorder.lineTo(intersectionPoint);
                     else
-                        fullPath.lineTo(currentGeometryPoint);
+                        fullRecorder.lineTo(currentGeometryPoint);
                     currentSegmentPath->lineTo(currentGeometryPoint);
                 }
             } else {
@@ -276,22 +399,24 @@ void LineChartItem::updateGeometry()
 
             previousPointWasOffGrid = pointOffGrid;
             if (m_pointsVisible && !pointOffGrid && currentSeriesPoint.y() >= minY) {
-                linePath.addEllipse(points.at(i), size, size);
-                fullPath.addEllipse(points.at(i), size, size);
-                linePath.moveTo(points.at(i));
-                fullPath.moveTo(points.at(i));
+                lineRecorder.addEllipse(points.at(i), size);
+                fullRecorder.addEllipse(points.at(i), size);
+                lineRecorder.moveTo(points.at(i));
+                fullRecorder.moveTo(points.at(i));
             }
             previousSegmentPath = currentSegmentPath;
             previousGeometryPoint = currentGeometryPoint;
         }
-        m_linePathPolarRight = linePathRight;
-        m_linePathPolarLeft = linePathLeft;
+        linePath = lineRecorder.toPath();
+        fullPath = fullRecorder.toPath();
+        m_linePathPolarRight = rightRecorder.toPath();
+        m_linePathPolarLeft = leftRecorder.toPath();
         // Note: This construction of m_fullpath is not perfect. The partial segments that are
         // outside left/right clip regions at axis boundary still generate hover/click events,
         // because shape doesn't get clipped. It doesn't seem possible to do sensibly.
     } else { // not polar
-        linePath.moveTo(points.at(0));
         if (m_pointsVisible) {
+            linePath.moveTo(points.at(0));
             int size = m_linePen.width();
             linePath.addEllipse(points.at(0), size, size);
             linePath.moveTo(points.at(0));
@@ -300,55 +425,176 @@ void LineChartItem::updateGeometry()
                 linePath.addEllipse(points.at(i), size, size);
                 linePath.moveTo(points.at(i));
             }
+            fullPath = linePath;
+        } else if (finiteBoundingRect(points, pointsRect)) {
+            deferPaths = true;
         } else {
+            // Paths skip the points that are not finite, while painting from the points can't.
+            linePath.moveTo(points.at(0));
             for (int i = 1; i < points.size(); i++)
                 linePath.lineTo(points.at(i));
+            fullPath = linePath;
         }
-        fullPath = linePath;
     }
 
-    QPainterPathStroker stroker;
-    // QPainter::drawLine does not respect join styles, for example BevelJoin becomes MiterJoin.
-    // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
-    // multiply line width with square root of two when defining shape and bounding rectangle.
-    stroker.setWidth(margin);
-    stroker.setJoinStyle(Qt::MiterJoin);
-    stroker.setCapStyle(Qt::SquareCap);
-    stroker.setMiterLimit(m_linePen.miterLimit());
+    // The bounding rect covers the stroke of the full path, which contains the line path.
+    const QRectF rect = deferPaths
+            ? strokeBoundingRect(pointsRect, margin, m_linePen.miterLimit())
+            : strokeBoundingRect(fullPath, margin, m_linePen.miterLimit());
 
-    QPainterPath checkShapePath = stroker.createStroke(fullPath);
-
-    // Only zoom in if the bounding rects of the paths fit inside int limits. QWidget::update() uses
-    // a region that has to be compatible with QRect.
-    if (checkShapePath.boundingRect().height() <= INT_MAX
-            && checkShapePath.boundingRect().width() <= INT_MAX
-            && linePath.boundingRect().height() <= INT_MAX
-            && linePath.boundingRect().width() <= INT_MAX
-            && fullPath.boundingRect().height() <= INT_MAX
-            && fullPath.boundingRect().width() <= INT_MAX) {
+    // Only zoom in if the bounding rect of the stroke fits inside int limits. QWidget::update()
+    // uses a region that has to be compatible with QRect.
+    if (rect.height() <= INT_MAX && rect.width() <= INT_MAX) {
         prepareGeometryChange();
 
         m_linePath = linePath;
         m_fullPath = fullPath;
-        m_shapePath = checkShapePath;
+        m_pathsDeferred = deferPaths;
+        m_shapePath = QPainterPath();
+        m_shapeDirty = true;
+
+        m_rect = rect;
+    } else {
+        update();
+    }
+}
+
+// Reduces the points to the first, minimum, maximum, and last point of each run of consecutive
+// points that fall into the same pixel column. Rasterizing the reduced line touches exactly the
+// same pixels as rasterizing the full line, so the result looks the same.
+QVector<QPointF> LineChartItem::decimatedPoints(const QVector<QPointF> &points) const
+{
+    const int count = points.size();
+    // Not worth the effort unless there are clearly more points than pixel columns.
+    if (count <= 4 * qMax(qreal(1.0), domain()->size().width()))
+        return points;
+
+    QVector<QPointF> result;
+    result.reserve(4 * int(domain()->size().width()) + 4);
+
+    int first = 0;
+    while (first < count) {
+        const qreal column = std::floor(points.at(first).x());
+        int minIndex = first;
+        int maxIndex = first;
+        int last = first + 1;
+        while (last < count && std::floor(points.at(last).x()) == column) {
+            const qreal y = points.at(last).y();
+            if (y < points.at(minIndex).y())
+                minIndex = last;
+            else if (y > points.at(maxIndex).y())
+                maxIndex = last;
+            last++;
+        }
+        last--;
+
+        // Keep the original order of the points so that the connecting segments are preserved.
+        result.append(points.at(first));
+        const int lower = qMin(minIndex, maxIndex);
+        const int upper = qMax(minIndex, maxIndex);
+        if (lower != first)
+            result.append(points.at(lower));
+        if (upper != lower && upper != first)
+            result.append(points.at(upper));
+        if (last != upper && last != first)
+            result.append(points.at(last));
+
+        first = last + 1;
+    }
+    return result;
+}
+
+// Appends the geometry points starting from the index first to the existing line, so that
+// streamed data does not require rebuilding the whole path and shape.
+void LineChartItem::extendGeometry(int first)
+{
+    QChart::ChartType chartType = m_chartType;
+    if (chartType == QChart::ChartTypeUndefined)
+        chartType = m_series->chart()->chartType();
+
+    const QVector<QPointF> &points = geometryPoints();
+
+    // Polar segments depend on their neighbors and decimation or visible points change the
+    // structure of the path, so those need a full update.
+    if (m_series->useOpenGL() || chartType == QChart::ChartTypePolar || m_pointsVisible
+        || m_decimationMode != QLineSeries::NoDecimation || first == 0
+        || m_linePoints.size() != first || points.size() <= first) {
+        updateGeometry();
+        return;
+    }
+
+    QPolygonF tail;
+    tail.reserve(points.size() - first + 1);
+    tail.append(m_linePoints.last());
+    for (int i = first; i < points.size(); i++) {
+        const QPointF &point = points.at(i);
+        m_linePoints.append(point);
+        tail.append(point);
+        if (!m_pathsDeferred) {
+            m_linePath.lineTo(point);
+            m_fullPath.lineTo(point);
+        }
+    }
+
+    const QRectF rect = m_rect.united(strokeBoundingRect(tail.boundingRect(),
+                                                         m_linePen.width() * 1.42,
+                                                         m_linePen.miterLimit()));
 
-        m_rect = m_shapePath.boundingRect();
+    // See updateGeometry() for the int limit.
+    if (rect.height() <= INT_MAX && rect.width() <= INT_MAX) {
+        prepareGeometryChange();
+        m_shapePath = QPainterPath();
+        m_shapeDirty = true;
+        m_rect = rect;
     } else {
         update();
     }
 }
 
+// Creates the line paths of a plain cartesian line from the line points if updateGeometry()
+// deferred them.
+void LineChartItem::createDeferredPaths() const
+{
+    if (!m_pathsDeferred)
+        return;
+    QPainterPath linePath;
+    linePath.moveTo(m_linePoints.at(0));
+    for (int i = 1; i < m_linePoints.size(); i++)
+        linePath.lineTo(m_linePoints.at(i));
+    m_linePath = linePath;
+    m_fullPath = linePath;
+    m_pathsDeferred = false;
+}
+
+QPainterPathStroker LineChartItem::shapeStroker() const
+{
+    QPainterPathStroker stroker;
+    // QPainter::drawLine does not respect join styles, for example BevelJoin becomes MiterJoin.
+    // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
+    // multiply line width with square root of two when defining shape and bounding rectangle.
+    stroker.setWidth(m_linePen.width() * 1.42);
+    stroker.setJoinStyle(Qt::MiterJoin);
+    stroker.setCapStyle(Qt::SquareCap);
+    stroker.setMiterLimit(m_linePen.miterLimit());
+    return stroker;
+}
+
 void LineChartItem::handleUpdated()
 {
     // If points visibility has changed, a geometry update is needed.
     // Also, if pen changes when points are visible, geometry update is needed.
+    // Decimation mode and point label visibility affect the points the line is built from.
     bool doGeometryUpdate =
         (m_pointsVisible != m_series->pointsVisible())
-        || (m_series->pointsVisible() && (m_linePen != m_series->pen()));
+        || (m_series->pointsVisible() && (m_linePen != m_series->pen()))
+        || (m_decimationMode != m_series->decimationMode())
+        || (m_decimationMode != QLineSeries::NoDecimation
+            && m_pointLabelsVisible != m_series->pointLabelsVisible());
     bool visibleChanged = m_series->isVisible() != isVisible();
     setVisible(m_series->isVisible());
     setOpacity(m_series->opacity());
     m_pointsVisible = m_series->pointsVisible();
+    m_decimationMode = m_series->decimationMode();
     m_linePen = m_series->pen();
     m_pointLabelsFormat = m_series->pointLabelsFormat();
     m_pointLabelsVisible = m_series->pointLabelsVisible();
@@ -409,7 +655,12 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
         if (m_linePen.style() != Qt::SolidLine || alwaysUsePath) {
             // If pen style is not solid line, always fall back to path painting
             // to ensure proper continuity of the pattern
+            createDeferredPaths();
             painter->drawPath(m_linePath);
+        } else if (m_linePen.widthF() <= 1.0) {
+            // Joins of thin lines are not visible, so the whole line can be drawn at once. The
+            // paint engines draw thin polylines directly without stroking them.
+            painter->drawPolyline(m_linePoints.constData(), m_linePoints.size());
         } else {
             for (int i(1); i < m_linePoints.size(); i++)
                 painter->drawLine(m_linePoints.at(i - 1), m_linePoints.at(i));
@@ -421,7 +672,8 @@ void LineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *opt
             painter->setClipping(true);
         else
             painter->setClipping(false);
-        m_series->d_func()->drawSeriesPointLabels(painter, m_linePoints, m_linePen.width() / 2);
+        m_series->d_func()->drawSeriesPointLabels(painter, m_linePoints, m_linePen.width() / 2,
+                                                  geometryPointsOffset());
     }
 
     painter->restore();
@@ -42,6 +42,7 @@
 #include <QtCharts/QChartGlobal>
 #include <private/xychart_p.h>
 #include <QtCharts/QChart>
+#include <QtCharts/QLineSeries>
 #include <QtGui/QPen>
 #include <QtCharts/private/qchartglobal_p.h>
 
@@ -63,13 +64,15 @@ public:
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
     QPainterPath shape() const;
 
-    QPainterPath path() const { return m_fullPath; }
+    QPainterPath path() const { createDeferredPaths(); return m_fullPath; }
+    const QVector<QPointF> &linePoints() const { return m_linePoints; }
 
 public Q_SLOTS:
     void handleUpdated();
 
 protected:
     void updateGeometry();
+    void extendGeometry(int first);
     void mousePressEvent(QGraphicsSceneMouseEvent *event);
     void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
     void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
@@ -79,18 +82,28 @@ protected:
     void forceChartType(QChart::ChartType chartType) { m_chartType = chartType; }
 
 private:
+    QVector<QPointF> decimatedPoints(const QVector<QPointF> &points) const;
+    QPainterPathStroker shapeStroker() const;
+    void createDeferredPaths() const;
+
     QLineSeries *m_series;
-    QPainterPath m_linePath;
+    // Plain cartesian lines are painted from m_linePoints, so their paths are only created when
+    // needed, see createDeferredPaths().
+    mutable QPainterPath m_linePath;
     QPainterPath m_linePathPolarRight;
     QPainterPath m_linePathPolarLeft;
-    QPainterPath m_fullPath;
-    QPainterPath m_shapePath;
+    mutable QPainterPath m_fullPath;
+    mutable bool m_pathsDeferred;
+    // The stroke used for hit testing is created on demand in shape().
+    mutable QPainterPath m_shapePath;
+    mutable bool m_shapeDirty;
 
     QVector<QPointF> m_linePoints;
     QRectF m_rect;
     QPen m_linePen;
     bool m_pointsVisible;
     QChart::ChartType m_chartType;
+    QLineSeries::DecimationMode m_decimationMode;
 
     bool m_pointLabelsVisible;
     QString m_pointLabelsFormat;
@@ -104,6 +104,41 @@ QT_CHARTS_BEGIN_NAMESPACE
     \sa Qt::PenCapStyle
 */
 
+/*!
+    \enum QLineSeries::DecimationMode
+    \since 5.11
+
+    This enum type specifies how the data points of the series are reduced before
+    the line is drawn.
+
+    \value NoDecimation
+           Every data point is used to build the line.
+    \value MinMaxDecimation
+           For each pixel column of the plot area, only the first, minimum, maximum, and
+           last data point of the column are used to build the line. The resulting line is
+           visually identical to the full one, but it is built from at most four points per
+           pixel column.
+*/
+
+/*!
+    \property QLineSeries::decimationMode
+    \since 5.11
+    \brief How the data points are reduced before drawing the line.
+
+    Decimation is only applied when the series has clearly more data points than the plot
+    area has pixel columns, and only for cartesian charts. It is not applied when data points
+    or point labels are visible, because those are drawn for every data point.
+    This property has no effect on QSplineSeries.
+
+    By default, the decimation mode is \l NoDecimation.
+*/
+
+/*!
+    \fn void QLineSeries::decimationModeChanged(QLineSeries::DecimationMode mode)
+    \since 5.11
+    This signal is emitted when the decimation mode of the series changes to \a mode.
+*/
+
 /*!
     Constructs an empty series object that is a child of \a parent.
     When the series object is added to a QChartView or QChart instance, the ownership
@@ -142,6 +177,21 @@ QAbstractSeries::SeriesType QLineSeries::type() const
     return QAbstractSeries::SeriesTypeLine;
 }
 
+void QLineSeries::setDecimationMode(QLineSeries::DecimationMode mode)
+{
+    Q_D(QLineSeries);
+    if (d->m_decimationMode != mode) {
+        d->m_decimationMode = mode;
+        emit decimationModeChanged(mode);
+    }
+}
+
+QLineSeries::DecimationMode QLineSeries::decimationMode() const
+{
+    Q_D(const QLineSeries);
+    return d->m_decimationMode;
+}
+
 /*
 QDebug operator<< (QDebug debug, const QLineSeries series)
 {
@@ -157,7 +207,8 @@ QDebug operator<< (QDebug debug, const QLineSeries series)
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QLineSeriesPrivate::QLineSeriesPrivate(QLineSeries *q)
-    : QXYSeriesPrivate(q)
+    : QXYSeriesPrivate(q),
+      m_decimationMode(QLineSeries::NoDecimation)
 {
 
 }
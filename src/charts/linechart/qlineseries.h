@@ -41,12 +41,26 @@ class QLineSeriesPrivate;
 class QT_CHARTS_EXPORT QLineSeries : public QXYSeries
 {
     Q_OBJECT
+    Q_PROPERTY(DecimationMode decimationMode READ decimationMode WRITE setDecimationMode NOTIFY decimationModeChanged)
+    Q_ENUMS(DecimationMode)
+
+public:
+    enum DecimationMode {
+        NoDecimation = 0x0,
+        MinMaxDecimation = 0x1
+    };
 
 public:
     explicit QLineSeries(QObject *parent = nullptr);
     ~QLineSeries();
     QAbstractSeries::SeriesType type() const;
 
+    void setDecimationMode(QLineSeries::DecimationMode mode);
+    QLineSeries::DecimationMode decimationMode() const;
+
+Q_SIGNALS:
+    void decimationModeChanged(QLineSeries::DecimationMode mode);
+
 protected:
     QLineSeries(QLineSeriesPrivate &d, QObject *parent = nullptr);
 
@@ -39,6 +39,7 @@
 #ifndef QLINESERIES_P_H
 #define QLINESERIES_P_H
 
+#include <QtCharts/QLineSeries>
 #include <private/qxyseries_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
 
@@ -52,6 +53,9 @@ public:
     void initializeGraphics(QGraphicsItem* parent);
     void initializeTheme(int index, ChartTheme* theme, bool forced = false);
 
+protected:
+    QLineSeries::DecimationMode m_decimationMode;
+
 private:
     Q_DECLARE_PUBLIC(QLineSeries);
 };
@@ -133,6 +133,18 @@ QT_CHARTS_BEGIN_NAMESPACE
  \brief The easing curve of the animation for the chart.
  */
 
+/*!
+ \property QChart::animationPointLimit
+ \brief The maximum number of points in a series for which changes are animated.
+ \since 5.11
+
+ Changes to series with more points are shown without series animations.
+ Interpolating large series on every animation frame can be expensive.
+ A negative value means that there is no limit. The default value is -1.
+
+ \sa animationOptions
+ */
+
 /*!
  \property QChart::backgroundVisible
  \brief Whether the chart background is visible.
@@ -683,6 +695,16 @@ QEasingCurve QChart::animationEasingCurve() const
     return d_ptr->m_presenter->animationEasingCurve();
 }
 
+void QChart::setAnimationPointLimit(int count)
+{
+    d_ptr->m_presenter->setAnimationPointLimit(count);
+}
+
+int QChart::animationPointLimit() const
+{
+    return d_ptr->m_presenter->animationPointLimit();
+}
+
 /*!
     Scrolls the visible area of the chart by the distance specified by \a dx and \a dy.
 
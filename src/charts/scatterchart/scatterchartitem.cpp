@@ -37,9 +37,14 @@
 #include <QtWidgets/QGraphicsScene>
 #include <QtCore/QDebug>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
+#include <QtCore/QtMath>
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// Series with more points than this are drawn in batched mode, as the per-marker graphics items
+// become the bottleneck.
+static const int batchedMarkerThreshold = 1000;
+
 ScatterChartItem::ScatterChartItem(QScatterSeries *series, QGraphicsItem *item)
     : XYChart(series,item),
       m_series(series),
@@ -52,7 +57,13 @@ ScatterChartItem::ScatterChartItem(QScatterSeries *series, QGraphicsItem *item)
       m_pointLabelsFont(series->pointLabelsFont()),
       m_pointLabelsColor(series->pointLabelsColor()),
       m_pointLabelsClipping(true),
-      m_mousePressed(false)
+      m_mousePressed(false),
+      m_batched(false),
+      m_gridColumns(0),
+      m_gridRows(0),
+      m_gridCellSize(1.0),
+      m_markerPixmapAntialiased(false),
+      m_hoveredMarker(-1)
 {
     QObject::connect(m_series->d_func(), SIGNAL(updated()), this, SLOT(handleUpdated()));
     QObject::connect(m_series, SIGNAL(visibleChanged()), this, SLOT(handleUpdated()));
@@ -78,6 +89,15 @@ QRectF ScatterChartItem::boundingRect() const
     return m_rect;
 }
 
+bool ScatterChartItem::contains(const QPointF &point) const
+{
+    // In batched mode only the markers are part of the item, so that mouse events on the empty
+    // plot area are delivered to the items below.
+    if (m_batched)
+        return markerAt(point) >= 0;
+    return XYChart::contains(point);
+}
+
 void ScatterChartItem::createPoints(int count)
 {
     for (int i = 0; i < count; ++i) {
@@ -139,11 +159,125 @@ void ScatterChartItem::markerDoubleClicked(QGraphicsItem *marker)
     emit XYChart::doubleClicked(m_markerMap[marker]);
 }
 
+void ScatterChartItem::updateMarkerIndex()
+{
+    m_markerIndices.clear();
+    m_gridCellStart.clear();
+    m_gridEntries.clear();
+    m_gridColumns = 0;
+    m_gridRows = 0;
+
+    const QVector<QPointF> points = geometryPoints();
+    if (!m_visible || points.isEmpty())
+        return;
+
+    // Markers never extend further than one cell from the cell their center is in,
+    // so only the neighboring cells need to be checked when hit testing.
+    const QSizeF size = domain()->size();
+    m_gridCellSize = qMax(qreal(m_size) + m_series->pen().widthF(), qreal(8.0));
+    m_gridColumns = qMax(1, qCeil(size.width() / m_gridCellSize));
+    m_gridRows = qMax(1, qCeil(size.height() / m_gridCellSize));
+
+    const QVector<bool> offGridStatus = offGridStatusVector();
+    QVector<int> markerCells;
+    markerCells.reserve(points.size());
+    m_markerIndices.reserve(points.size());
+    m_gridCellStart.fill(0, m_gridColumns * m_gridRows + 1);
+
+    for (int i = 0; i < points.size(); i++) {
+        const QPointF &point = points.at(i);
+        if (offGridStatus.at(i) || !qIsFinite(point.x()) || !qIsFinite(point.y()))
+            continue;
+        const int column = qBound(0, int(point.x() / m_gridCellSize), m_gridColumns - 1);
+        const int row = qBound(0, int(point.y() / m_gridCellSize), m_gridRows - 1);
+        const int cell = row * m_gridColumns + column;
+        m_markerIndices.append(i);
+        markerCells.append(cell);
+        m_gridCellStart[cell + 1]++;
+    }
+
+    // Counting sort of the marker indices by cell.
+    for (int cell = 0; cell < m_gridColumns * m_gridRows; cell++)
+        m_gridCellStart[cell + 1] += m_gridCellStart[cell];
+    QVector<int> cellFill = m_gridCellStart;
+    m_gridEntries.resize(m_markerIndices.size());
+    for (int i = 0; i < m_markerIndices.size(); i++)
+        m_gridEntries[cellFill[markerCells.at(i)]++] = m_markerIndices.at(i);
+}
+
+void ScatterChartItem::updateMarkerPixmap(qreal devicePixelRatio, bool antialiasing)
+{
+    const QPen pen = m_series->pen();
+    // Leave room for the pen and the antialiased edge around the marker.
+    const qreal margin = qMax(pen.widthF(), qreal(1.0)) / 2.0 + 1.0;
+    const int extent = qCeil((m_size + 2.0 * margin) * devicePixelRatio);
+
+    m_markerPixmap = QPixmap(extent, extent);
+    m_markerPixmap.setDevicePixelRatio(devicePixelRatio);
+    m_markerPixmap.fill(Qt::transparent);
+    m_markerPixmapAntialiased = antialiasing;
+
+    QPainter painter(&m_markerPixmap);
+    painter.setRenderHint(QPainter::Antialiasing, antialiasing);
+    painter.setPen(pen);
+    painter.setBrush(m_series->brush());
+    const qreal center = extent / devicePixelRatio / 2.0;
+    const QRectF rect(center - m_size / 2.0, center - m_size / 2.0, m_size, m_size);
+    if (m_shape == QScatterSeries::MarkerShapeCircle)
+        painter.drawEllipse(rect);
+    else
+        painter.drawRect(rect);
+}
+
+// Returns the index of the topmost marker at pos, or -1 if there is no marker at pos.
+int ScatterChartItem::markerAt(const QPointF &pos) const
+{
+    if (m_gridEntries.isEmpty())
+        return -1;
+
+    const QVector<QPointF> points = geometryPoints();
+    const qreal radius = m_size / 2.0 + m_series->pen().widthF() / 2.0;
+    const int column = int(qFloor(pos.x() / m_gridCellSize));
+    const int row = int(qFloor(pos.y() / m_gridCellSize));
+    int found = -1;
+
+    for (int r = qMax(0, row - 1); r <= qMin(m_gridRows - 1, row + 1); r++) {
+        for (int c = qMax(0, column - 1); c <= qMin(m_gridColumns - 1, column + 1); c++) {
+            const int cell = r * m_gridColumns + c;
+            for (int entry = m_gridCellStart.at(cell); entry < m_gridCellStart.at(cell + 1); entry++) {
+                const int index = m_gridEntries.at(entry);
+                // Markers painted later are on top, so the highest index wins.
+                if (index <= found || index >= points.size())
+                    continue;
+                const qreal dx = pos.x() - points.at(index).x();
+                const qreal dy = pos.y() - points.at(index).y();
+                bool hit;
+                if (m_shape == QScatterSeries::MarkerShapeCircle)
+                    hit = dx * dx + dy * dy <= radius * radius;
+                else
+                    hit = qAbs(dx) <= radius && qAbs(dy) <= radius;
+                if (hit)
+                    found = index;
+            }
+        }
+    }
+    return found;
+}
+
+QPointF ScatterChartItem::markerPoint(int index) const
+{
+    // See updateGeometry() for why the index is limited to the series size.
+    const QScatterSeriesPrivate *d = m_series->d_func();
+    return d->pointAt(qMin(d->count() - 1, index));
+}
+
 void ScatterChartItem::updateGeometry()
 {
     if (m_series->useOpenGL()) {
         if (m_items.childItems().count())
             deletePoints(m_items.childItems().count());
+        m_markerIndices.clear();
+        m_gridEntries.clear();
         if (!m_rect.isEmpty()) {
             prepareGeometryChange();
             // Changed signal seems to trigger even with empty region
@@ -157,6 +291,33 @@ void ScatterChartItem::updateGeometry()
 
     if (points.size() == 0) {
         deletePoints(m_items.childItems().count());
+        m_markerIndices.clear();
+        m_gridEntries.clear();
+        return;
+    }
+
+    const bool batched = points.size() > batchedMarkerThreshold;
+    if (batched != m_batched) {
+        m_batched = batched;
+        setAcceptHoverEvents(m_batched);
+        m_hoveredMarker = -1;
+        m_markerIndices.clear();
+        m_gridEntries.clear();
+        m_markerPixmap = QPixmap();
+        if (m_batched) {
+            deletePoints(m_items.childItems().count());
+            handleUpdated();
+        }
+    }
+
+    if (m_batched) {
+        QRectF clipRect(QPointF(0, 0), domain()->size());
+        if (clipRect.height() <= INT_MAX && clipRect.width() <= INT_MAX) {
+            updateMarkerIndex();
+            prepareGeometryChange();
+            m_rect = clipRect;
+        }
+        update();
         return;
     }
 
@@ -179,7 +340,8 @@ void ScatterChartItem::updateGeometry()
     if (clipRect.height() <= INT_MAX
             && clipRect.width() <= INT_MAX) {
         QVector<bool> offGridStatus = offGridStatusVector();
-        const int seriesLastIndex = m_series->count() - 1;
+        const XYSeriesColumns columns = m_series->d_func()->columns();
+        const int seriesLastIndex = columns.count() - 1;
 
         for (int i = 0; i < points.size(); i++) {
             QGraphicsItem *item = items.at(i);
@@ -192,7 +354,7 @@ void ScatterChartItem::updateGeometry()
             // Note that marker map values can be technically incorrect during the animation,
             // if it was caused by an insert, but this shouldn't be a problem as the points are
             // fake anyway. After remove animation stops, geometry is updated to correct one.
-            m_markerMap[item] = m_series->at(qMin(seriesLastIndex, i));
+            m_markerMap[item] = columns.at(qMin(seriesLastIndex, i));
             QPointF position;
             position.setX(point.x() - rect.width() / 2);
             position.setY(point.y() - rect.height() / 2);
@@ -222,6 +384,22 @@ void ScatterChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     painter->save();
     painter->setClipRect(clipRect);
 
+    if (m_batched && !m_markerIndices.isEmpty()) {
+        const qreal devicePixelRatio = painter->device()->devicePixelRatioF();
+        const bool antialiasing = painter->testRenderHint(QPainter::Antialiasing);
+        if (m_markerPixmap.isNull() || m_markerPixmap.devicePixelRatio() != devicePixelRatio
+            || m_markerPixmapAntialiased != antialiasing) {
+            updateMarkerPixmap(devicePixelRatio, antialiasing);
+        }
+        const qreal halfExtent = m_markerPixmap.width() / devicePixelRatio / 2.0;
+        const QPointF offset(halfExtent, halfExtent);
+        const QVector<QPointF> points = geometryPoints();
+        foreach (int index, m_markerIndices) {
+            if (index < points.size())
+                painter->drawPixmap(points.at(index) - offset, m_markerPixmap);
+        }
+    }
+
     if (m_pointLabelsVisible) {
         if (m_pointLabelsClipping)
             painter->setClipping(true);
@@ -258,7 +436,7 @@ void ScatterChartItem::handleUpdated()
     }
 
     int count = m_items.childItems().count();
-    if (count == 0)
+    if (count == 0 && !m_batched)
         return;
 
     bool recreate = m_visible != m_series->isVisible()
@@ -275,6 +453,16 @@ void ScatterChartItem::handleUpdated()
     m_pointLabelsColor = m_series->pointLabelsColor();
     m_pointLabelsClipping = m_series->pointLabelsClipping();
 
+    if (m_batched) {
+        // Pen, brush, and shape are baked into the marker pixmap, and the marker size and
+        // visibility affect hit testing.
+        m_markerPixmap = QPixmap();
+        if (recreate)
+            updateMarkerIndex();
+        update();
+        return;
+    }
+
     if (recreate) {
         deletePoints(count);
         createPoints(count);
@@ -288,6 +476,69 @@ void ScatterChartItem::handleUpdated()
     update();
 }
 
+void ScatterChartItem::mousePressEvent(QGraphicsSceneMouseEvent *event)
+{
+    // Only reached in batched mode, the marker items handle the events otherwise.
+    const int index = markerAt(event->pos());
+    if (index < 0) {
+        event->ignore();
+        return;
+    }
+    m_pressedPoint = markerPoint(index);
+    emit XYChart::pressed(m_pressedPoint);
+    setMousePressed();
+    event->accept();
+}
+
+void ScatterChartItem::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
+{
+    hoverMoveEvent(event);
+}
+
+void ScatterChartItem::hoverMoveEvent(QGraphicsSceneHoverEvent *event)
+{
+    // Adjacent markers may overlap, so the hovered marker can change without the item
+    // being left.
+    const int index = markerAt(event->pos());
+    if (index == m_hoveredMarker)
+        return;
+    if (m_hoveredMarker >= 0)
+        emit XYChart::hovered(m_hoveredPoint, false);
+    m_hoveredMarker = index;
+    if (m_hoveredMarker >= 0) {
+        m_hoveredPoint = markerPoint(m_hoveredMarker);
+        emit XYChart::hovered(m_hoveredPoint, true);
+    }
+}
+
+void ScatterChartItem::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
+{
+    Q_UNUSED(event)
+    if (m_hoveredMarker >= 0)
+        emit XYChart::hovered(m_hoveredPoint, false);
+    m_hoveredMarker = -1;
+}
+
+void ScatterChartItem::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
+{
+    emit XYChart::released(m_pressedPoint);
+    if (mousePressed())
+        emit XYChart::clicked(m_pressedPoint);
+    setMousePressed(false);
+    event->accept();
+}
+
+void ScatterChartItem::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
+{
+    const int index = markerAt(event->pos());
+    if (index < 0) {
+        event->ignore();
+        return;
+    }
+    emit XYChart::doubleClicked(markerPoint(index));
+    event->accept();
+}
+
 #include "moc_scatterchartitem_p.cpp"
 
 QT_CHARTS_END_NAMESPACE
@@ -43,6 +43,7 @@
 #include <private/xychart_p.h>
 #include <QtWidgets/QGraphicsEllipseItem>
 #include <QtGui/QPen>
+#include <QtGui/QPixmap>
 #include <QtWidgets/QGraphicsSceneMouseEvent>
 #include <QtCharts/private/qchartglobal_p.h>
 
@@ -61,6 +62,7 @@ public:
     //from QGraphicsItem
     QRectF boundingRect() const;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
+    bool contains(const QPointF &point) const;
 
     void setPen(const QPen &pen);
     void setBrush(const QBrush &brush);
@@ -82,8 +84,19 @@ private:
     void createPoints(int count);
     void deletePoints(int count);
 
+    void updateMarkerIndex();
+    void updateMarkerPixmap(qreal devicePixelRatio, bool antialiasing);
+    int markerAt(const QPointF &pos) const;
+    QPointF markerPoint(int index) const;
+
 protected:
     void updateGeometry();
+    void mousePressEvent(QGraphicsSceneMouseEvent *event);
+    void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
+    void hoverMoveEvent(QGraphicsSceneHoverEvent *event);
+    void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
+    void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
+    void mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event);
 
 private:
     QScatterSeries *m_series;
@@ -94,6 +107,21 @@ private:
     QRectF m_rect;
     QMap<QGraphicsItem *, QPointF> m_markerMap;
 
+    // Batched mode: markers are painted directly by this item instead of one child item per
+    // marker, and hit testing is done through a uniform grid over the plot area.
+    bool m_batched;
+    QVector<int> m_markerIndices;
+    QVector<int> m_gridCellStart;
+    QVector<int> m_gridEntries;
+    int m_gridColumns;
+    int m_gridRows;
+    qreal m_gridCellSize;
+    QPixmap m_markerPixmap;
+    bool m_markerPixmapAntialiased;
+    int m_hoveredMarker;
+    QPointF m_hoveredPoint;
+    QPointF m_pressedPoint;
+
     bool m_pointLabelsVisible;
     QString m_pointLabelsFormat;
     QFont m_pointLabelsFont;
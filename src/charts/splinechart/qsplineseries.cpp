@@ -144,6 +144,24 @@ QSplineSeriesPrivate::QSplineSeriesPrivate(QSplineSeries *q)
 {
 }
 
+void QSplineSeriesPrivate::pointsAppended(int first)
+{
+    QLineSeriesPrivate::pointsAppended(first);
+    m_controlPoints.pointsAppended(first, count());
+}
+
+void QSplineSeriesPrivate::pointsUpdated(int index, int count)
+{
+    QLineSeriesPrivate::pointsUpdated(index, count);
+    m_controlPoints.pointsUpdated(index, count);
+}
+
+void QSplineSeriesPrivate::pointsReset()
+{
+    QLineSeriesPrivate::pointsReset();
+    m_controlPoints.invalidate();
+}
+
 void QSplineSeriesPrivate::initializeGraphics(QGraphicsItem* parent)
 {
     Q_Q(QSplineSeries);
@@ -40,6 +40,7 @@
 #define QSPLINESERIES_P_H
 
 #include <private/qlineseries_p.h>
+#include <private/splinecontrolpoints_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -56,6 +57,13 @@ public:
     void initializeAnimations(QtCharts::QChart::AnimationOptions options, int duration,
                               QEasingCurve &curve);
 
+    void pointsAppended(int first);
+    void pointsUpdated(int index, int count);
+    void pointsReset();
+
+    // Control points of the spline in series coordinates.
+    SplineControlPoints m_controlPoints;
+
 private:
     Q_DECLARE_PUBLIC(QSplineSeries)
 };
@@ -2,11 +2,13 @@ INCLUDEPATH += $$PWD
 
 SOURCES += \
     $$PWD/qsplineseries.cpp \
-    $$PWD/splinechartitem.cpp
+    $$PWD/splinechartitem.cpp \
+    $$PWD/splinecontrolpoints.cpp
 
 PRIVATE_HEADERS += \
     $$PWD/splinechartitem_p.h \
-    $$PWD/qsplineseries_p.h
+    $$PWD/qsplineseries_p.h \
+    $$PWD/splinecontrolpoints_p.h
 
 PUBLIC_HEADERS += \
     $$PWD/qsplineseries.h
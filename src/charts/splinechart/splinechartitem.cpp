@@ -40,6 +40,7 @@ QT_CHARTS_BEGIN_NAMESPACE
 SplineChartItem::SplineChartItem(QSplineSeries *series, QGraphicsItem *item)
     : XYChart(series,item),
       m_series(series),
+      m_shapeDirty(true),
       m_pointsVisible(false),
       m_animation(0),
       m_pointLabelsVisible(false),
@@ -52,6 +53,8 @@ SplineChartItem::SplineChartItem(QSplineSeries *series, QGraphicsItem *item)
     setAcceptHoverEvents(true);
     setFlag(QGraphicsItem::ItemIsSelectable);
     setZValue(ChartPresenter::SplineChartZValue);
+    // The segments next to the view depend on the control points of the points around them.
+    setCullingMargin(SplineControlPoints::window);
     QObject::connect(m_series->d_func(), SIGNAL(updated()), this, SLOT(handleUpdated()));
     QObject::connect(series, SIGNAL(visibleChanged()), this, SLOT(handleUpdated()));
     QObject::connect(series, SIGNAL(opacityChanged()), this, SLOT(handleUpdated()));
@@ -70,9 +73,23 @@ QRectF SplineChartItem::boundingRect() const
     return m_rect;
 }
 
+// See LineChartItem::shape().
 QPainterPath SplineChartItem::shape() const
 {
-    return m_fullPath;
+    if (!m_shapeDirty)
+        return m_shapePath;
+
+    QPainterPathStroker stroker;
+    // The full path is comprised of three separate paths.
+    // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
+    // multiply line width with square root of two when defining shape and bounding rectangle.
+    stroker.setWidth(m_linePen.width() * 1.42);
+    stroker.setJoinStyle(Qt::MiterJoin);
+    stroker.setCapStyle(Qt::SquareCap);
+    stroker.setMiterLimit(m_linePen.miterLimit());
+    m_shapePath = stroker.createStroke(m_fullPath);
+    m_shapeDirty = false;
+    return m_shapePath;
 }
 
 void SplineChartItem::setAnimation(SplineAnimation *animation)
@@ -98,23 +115,43 @@ QVector<QPointF> SplineChartItem::controlGeometryPoints() const
 
 void SplineChartItem::updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index)
 {
+    const bool animate = m_animation && isWithinAnimationPointLimit(newPoints.count())
+            && isAnimatable(oldPoints.count(), newPoints.count());
+    // The control points are taken from the range of the series of the new points.
+    applyPointsRange();
+
     QVector<QPointF> controlPoints;
     if (newPoints.count() >= 2)
         controlPoints = calculateControlPoints(newPoints);
 
-    if (m_animation)
+    if (animate)
         m_animation->setup(oldPoints, newPoints, m_controlPoints, controlPoints, index);
+    else if (m_animation && m_animation->state() != QAbstractAnimation::Stopped)
+        m_animation->stop();
 
     m_points = newPoints;
     m_controlPoints = controlPoints;
-    setDirty(false);
+    // Culled geometry points don't match the series points one to one.
+    setDirty(m_pointsCulled);
 
-    if (m_animation)
+    if (animate)
         presenter()->startAnimation(m_animation);
     else
         updateGeometry();
 }
 
+// Streamed points are not animated. The control points cached on the series are only solved
+// again around the new points.
+void SplineChartItem::extendGeometry(int first)
+{
+    Q_UNUSED(first)
+    if (m_points.count() >= 2)
+        m_controlPoints = calculateControlPoints(m_points);
+    else
+        m_controlPoints.clear();
+    updateGeometry();
+}
+
 void SplineChartItem::updateGeometry()
 {
     const QVector<QPointF> &points = m_points;
@@ -123,6 +160,9 @@ void SplineChartItem::updateGeometry()
     if ((points.size() < 2) || (controlPoints.size() < 2)) {
         prepareGeometryChange();
         m_path = QPainterPath();
+        m_fullPath = QPainterPath();
+        m_shapePath = QPainterPath();
+        m_shapeDirty = true;
         m_rect = QRect();
         return;
     }
@@ -142,7 +182,9 @@ void SplineChartItem::updateGeometry()
         qreal minX = domain()->minX();
         qreal maxX = domain()->maxX();
         qreal minY = domain()->minY();
-        QPointF currentSeriesPoint = m_series->at(0);
+        // The series values are read from the series columns, which are not copied to points.
+        const XYSeriesColumns columns = m_series->d_func()->columns();
+        QPointF currentSeriesPoint = columns.at(0);
         QPointF currentGeometryPoint = points.at(0);
         QPointF previousGeometryPoint = points.at(0);
         bool pointOffGrid = false;
@@ -165,7 +207,7 @@ void SplineChartItem::updateGeometry()
         qreal horizontal = centerPoint.y();
 
         // See ScatterChartItem::updateGeometry() for explanation why seriesLastIndex is needed
-        const int seriesLastIndex = m_series->count() - 1;
+        const int seriesLastIndex = columns.count() - 1;
 
         for (int i = 1; i < points.size(); i++) {
             // Interpolating spline fragments accurately is not trivial, and would anyway be ugly
@@ -180,7 +222,7 @@ void SplineChartItem::updateGeometry()
             // degrees and both of the points are within the margin, one in the top half and one in the
             // bottom half of the chart, the bottom one gets clipped incorrectly.
             // However, this should be rare occurrence in any sensible chart.
-            currentSeriesPoint = m_series->at(qMin(seriesLastIndex, i));
+            currentSeriesPoint = columns.at(qMin(seriesLastIndex, i));
             currentGeometryPoint = points.at(i);
             pointOffGrid = (currentSeriesPoint.x() < minX || currentSeriesPoint.x() > maxX);
 
@@ -188,7 +230,7 @@ void SplineChartItem::updateGeometry()
             if (!pointOffGrid || !previousPointWasOffGrid) {
                 bool dummyOk; // We know points are ok, but this is needed
                 qreal currentAngle = static_cast<PolarDomain *>(domain())->toAngularCoordinate(currentSeriesPoint.x(), dummyOk);
-                qreal previousAngle = static_cast<PolarDomain *>(domain())->toAngularCoordinate(m_series->at(i - 1).x(), dummyOk);
+                qreal previousAngle = static_cast<PolarDomain *>(domain())->toAngularCoordinate(columns.x().at(qMin(seriesLastIndex, i - 1)), dummyOk);
 
                 if ((qAbs(currentAngle - previousAngle) > 180.0)) {
                     // If the angle between two points is over 180 degrees (half X range),
@@ -291,126 +333,38 @@ void SplineChartItem::updateGeometry()
         fullPath = splinePath;
     }
 
-    QPainterPathStroker stroker;
-    // The full path is comprised of three separate paths.
-    // This is why we are prepared for the "worst case" scenario, i.e. use always MiterJoin and
-    // multiply line width with square root of two when defining shape and bounding rectangle.
-    stroker.setWidth(margin);
-    stroker.setJoinStyle(Qt::MiterJoin);
-    stroker.setCapStyle(Qt::SquareCap);
-    stroker.setMiterLimit(m_linePen.miterLimit());
+    // The bounding rect covers the stroke of the full path, which contains the spline path.
+    const QRectF rect = strokeBoundingRect(fullPath, margin, m_linePen.miterLimit());
 
-    // Only zoom in if the bounding rects of the path fit inside int limits. QWidget::update() uses
-    // a region that has to be compatible with QRect.
-    QPainterPath checkShapePath = stroker.createStroke(fullPath);
-    if (checkShapePath.boundingRect().height() <= INT_MAX
-            && checkShapePath.boundingRect().width() <= INT_MAX
-            && splinePath.boundingRect().height() <= INT_MAX
-            && splinePath.boundingRect().width() <= INT_MAX) {
+    // Only zoom in if the bounding rect of the stroke fits inside int limits. QWidget::update()
+    // uses a region that has to be compatible with QRect.
+    if (rect.height() <= INT_MAX && rect.width() <= INT_MAX) {
         m_path = splinePath;
 
         prepareGeometryChange();
 
-        m_fullPath = checkShapePath;
-        m_rect = m_fullPath.boundingRect();
+        m_fullPath = fullPath;
+        m_shapePath = QPainterPath();
+        m_shapeDirty = true;
+        m_rect = rect;
     }
 }
 
-/*!
-  Calculates control points which are needed by QPainterPath.cubicTo function to draw the cubic Bezier cureve between two points.
-  */
+// Calculates the control points for the geometry points. The control points are invariant
+// under affine maps, so with linear axes the control points cached on the series in series
+// coordinates are mapped like the points instead of being solved again.
 QVector<QPointF> SplineChartItem::calculateControlPoints(const QVector<QPointF> &points)
 {
-    QVector<QPointF> controlPoints;
-    controlPoints.resize(points.count() * 2 - 2);
-
-    int n = points.count() - 1;
-
-    if (n == 1) {
-        //for n==1
-        controlPoints[0].setX((2 * points[0].x() + points[1].x()) / 3);
-        controlPoints[0].setY((2 * points[0].y() + points[1].y()) / 3);
-        controlPoints[1].setX(2 * controlPoints[0].x() - points[0].x());
-        controlPoints[1].setY(2 * controlPoints[0].y() - points[0].y());
-        return controlPoints;
+    if (domain()->type() == AbstractDomain::XYDomain && points.count() >= 2
+        && m_pointsOffset + points.count() <= m_series->count()) {
+        QSplineSeriesPrivate *d = m_series->d_func();
+        const QVector<QPointF> controlPoints = domain()->calculateGeometryPoints(
+                    d->m_controlPoints.controlPoints(d->columns()).mid(2 * m_pointsOffset,
+                                                                      2 * points.count() - 2));
+        if (controlPoints.count() == 2 * points.count() - 2)
+            return controlPoints;
     }
-
-    // Calculate first Bezier control points
-    // Set of equations for P0 to Pn points.
-    //
-    //  |   2   1   0   0   ... 0   0   0   ... 0   0   0   |   |   P1_1    |   |   P0 + 2 * P1             |
-    //  |   1   4   1   0   ... 0   0   0   ... 0   0   0   |   |   P1_2    |   |   4 * P1 + 2 * P2         |
-    //  |   0   1   4   1   ... 0   0   0   ... 0   0   0   |   |   P1_3    |   |   4 * P2 + 2 * P3         |
-    //  |   .   .   .   .   .   .   .   .   .   .   .   .   |   |   ...     |   |   ...                     |
-    //  |   0   0   0   0   ... 1   4   1   ... 0   0   0   | * |   P1_i    | = |   4 * P(i-1) + 2 * Pi     |
-    //  |   .   .   .   .   .   .   .   .   .   .   .   .   |   |   ...     |   |   ...                     |
-    //  |   0   0   0   0   0   0   0   0   ... 1   4   1   |   |   P1_(n-1)|   |   4 * P(n-2) + 2 * P(n-1) |
-    //  |   0   0   0   0   0   0   0   0   ... 0   2   7   |   |   P1_n    |   |   8 * P(n-1) + Pn         |
-    //
-    QVector<qreal> vector;
-    vector.resize(n);
-
-    vector[0] = points[0].x() + 2 * points[1].x();
-
-
-    for (int i = 1; i < n - 1; ++i)
-        vector[i] = 4 * points[i].x() + 2 * points[i + 1].x();
-
-    vector[n - 1] = (8 * points[n - 1].x() + points[n].x()) / 2.0;
-
-    QVector<qreal> xControl = firstControlPoints(vector);
-
-    vector[0] = points[0].y() + 2 * points[1].y();
-
-    for (int i = 1; i < n - 1; ++i)
-        vector[i] = 4 * points[i].y() + 2 * points[i + 1].y();
-
-    vector[n - 1] = (8 * points[n - 1].y() + points[n].y()) / 2.0;
-
-    QVector<qreal> yControl = firstControlPoints(vector);
-
-    for (int i = 0, j = 0; i < n; ++i, ++j) {
-
-        controlPoints[j].setX(xControl[i]);
-        controlPoints[j].setY(yControl[i]);
-
-        j++;
-
-        if (i < n - 1) {
-            controlPoints[j].setX(2 * points[i + 1].x() - xControl[i + 1]);
-            controlPoints[j].setY(2 * points[i + 1].y() - yControl[i + 1]);
-        } else {
-            controlPoints[j].setX((points[n].x() + xControl[n - 1]) / 2);
-            controlPoints[j].setY((points[n].y() + yControl[n - 1]) / 2);
-        }
-    }
-    return controlPoints;
-}
-
-QVector<qreal> SplineChartItem::firstControlPoints(const QVector<qreal>& vector)
-{
-    QVector<qreal> result;
-
-    int count = vector.count();
-    result.resize(count);
-    result[0] = vector[0] / 2.0;
-
-    QVector<qreal> temp;
-    temp.resize(count);
-    temp[0] = 0;
-
-    qreal b = 2.0;
-
-    for (int i = 1; i < count; i++) {
-        temp[i] = 1 / b;
-        b = (i < count - 1 ? 4.0 : 3.5) - temp[i];
-        result[i] = (vector[i] - result[i - 1]) / b;
-    }
-
-    for (int i = 1; i < count; i++)
-        result[count - i - 1] -= temp[count - i] * result[count - i];
-
-    return result;
+    return SplineControlPoints::calculate(points);
 }
 
 //handlers
@@ -475,7 +429,8 @@ void SplineChartItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *o
             painter->setClipping(true);
         else
             painter->setClipping(false);
-        m_series->d_func()->drawSeriesPointLabels(painter, m_points, m_linePen.width() / 2);
+        m_series->d_func()->drawSeriesPointLabels(painter, m_points, m_linePen.width() / 2,
+                                                  geometryPointsOffset());
     }
 
     painter->restore();
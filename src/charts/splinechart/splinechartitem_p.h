@@ -71,8 +71,8 @@ public Q_SLOTS:
 protected:
     void updateGeometry();
     QVector<QPointF> calculateControlPoints(const QVector<QPointF> &points);
-    QVector<qreal> firstControlPoints(const QVector<qreal>& vector);
     void updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index);
+    void extendGeometry(int first);
     void mousePressEvent(QGraphicsSceneMouseEvent *event);
     void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
     void hoverLeaveEvent(QGraphicsSceneHoverEvent *event);
@@ -85,6 +85,9 @@ private:
     QPainterPath m_pathPolarRight;
     QPainterPath m_pathPolarLeft;
     QPainterPath m_fullPath;
+    // The stroke used for hit testing is created on demand in shape().
+    mutable QPainterPath m_shapePath;
+    mutable bool m_shapeDirty;
     QRectF m_rect;
     QPen m_linePen;
     QPen m_pointPen;
@@ -0,0 +1,223 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/splinecontrolpoints_p.h>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Solves the first control points of the rows from first to last, and updates the second
+// control points that depend on them. If the rows do not cover all n rows, the first control
+// points next to them are taken from controlPoints, which must contain 2 * n values.
+//
+// Set of equations for P0 to Pn points, the last row is scaled by 1/2 when solved.
+//
+//  |   2   1   0   0   ... 0   0   0   ... 0   0   0   |   |   P1_1    |   |   P0 + 2 * P1             |
+//  |   1   4   1   0   ... 0   0   0   ... 0   0   0   |   |   P1_2    |   |   4 * P1 + 2 * P2         |
+//  |   0   1   4   1   ... 0   0   0   ... 0   0   0   |   |   P1_3    |   |   4 * P2 + 2 * P3         |
+//  |   .   .   .   .   .   .   .   .   .   .   .   .   |   |   ...     |   |   ...                     |
+//  |   0   0   0   0   ... 1   4   1   ... 0   0   0   | * |   P1_i    | = |   4 * P(i-1) + 2 * Pi     |
+//  |   .   .   .   .   .   .   .   .   .   .   .   .   |   |   ...     |   |   ...                     |
+//  |   0   0   0   0   0   0   0   0   ... 1   4   1   |   |   P1_(n-1)|   |   4 * P(n-2) + 2 * P(n-1) |
+//  |   0   0   0   0   0   0   0   0   ... 0   2   7   |   |   P1_n    |   |   8 * P(n-1) + Pn         |
+//
+static void solveRows(const XYSeriesColumns &points, QVector<QPointF> &controlPoints,
+                      int first, int last)
+{
+    const int n = points.count() - 1;
+    const int rows = last - first + 1;
+    QVector<qreal> upper(rows);
+    QVector<QPointF> result(rows);
+
+    // Forward elimination of the tridiagonal system, x and y are solved together.
+    for (int k = 0; k < rows; ++k) {
+        const int i = first + k;
+        qreal lower = 1.0;
+        qreal diagonal = 4.0;
+        qreal above = 1.0;
+        QPointF value;
+        if (i == 0) {
+            lower = 0.0;
+            diagonal = 2.0;
+            value = points.at(0) + 2 * points.at(1);
+        } else if (i == n - 1) {
+            diagonal = 3.5;
+            above = 0.0;
+            value = (8 * points.at(n - 1) + points.at(n)) / 2.0;
+        } else {
+            value = 4 * points.at(i) + 2 * points.at(i + 1);
+        }
+
+        // Known neighbors outside the solved rows are moved to the right hand side.
+        if (k == 0 && i > 0)
+            value -= lower * controlPoints[2 * (i - 1)];
+        if (k == rows - 1 && i < n - 1)
+            value -= above * controlPoints[2 * (i + 1)];
+
+        if (k == 0) {
+            upper[k] = above / diagonal;
+            result[k] = value / diagonal;
+        } else {
+            const qreal pivot = diagonal - lower * upper[k - 1];
+            upper[k] = above / pivot;
+            result[k] = (value - lower * result[k - 1]) / pivot;
+        }
+    }
+    for (int k = rows - 2; k >= 0; --k)
+        result[k] -= upper[k] * result[k + 1];
+
+    for (int k = 0; k < rows; ++k)
+        controlPoints[2 * (first + k)] = result[k];
+
+    // The second control point of a segment depends on the first control point of the next one.
+    for (int i = qMax(first - 1, 0); i <= last; ++i) {
+        if (i < n - 1)
+            controlPoints[2 * i + 1] = 2 * points.at(i + 1) - controlPoints[2 * (i + 1)];
+        else
+            controlPoints[2 * i + 1] = (points.at(n) + controlPoints[2 * i]) / 2;
+    }
+}
+
+SplineControlPoints::SplineControlPoints()
+    : m_count(0),
+      m_dirtyFirst(-1),
+      m_dirtyLast(-1),
+      m_valid(false)
+{
+}
+
+/*!
+  Calculates control points which are needed by QPainterPath.cubicTo function to draw the cubic Bezier cureve between two points.
+  */
+QVector<QPointF> SplineControlPoints::calculate(const QVector<QPointF> &points)
+{
+    return calculate(XYSeriesColumns(points));
+}
+
+// Calculates the control points from the values of a series, without copying them to points.
+QVector<QPointF> SplineControlPoints::calculate(const XYSeriesColumns &points)
+{
+    QVector<QPointF> controlPoints;
+    if (points.count() < 2)
+        return controlPoints;
+    controlPoints.resize(points.count() * 2 - 2);
+
+    int n = points.count() - 1;
+
+    if (n == 1) {
+        //for n==1
+        const QPointF first = points.at(0);
+        const QPointF last = points.at(1);
+        controlPoints[0].setX((2 * first.x() + last.x()) / 3);
+        controlPoints[0].setY((2 * first.y() + last.y()) / 3);
+        controlPoints[1].setX(2 * controlPoints[0].x() - first.x());
+        controlPoints[1].setY(2 * controlPoints[0].y() - first.y());
+        return controlPoints;
+    }
+
+    solveRows(points, controlPoints, 0, n - 1);
+    return controlPoints;
+}
+
+// Drops the control points, they are calculated again when they are requested.
+void SplineControlPoints::invalidate()
+{
+    m_valid = false;
+    m_dirtyFirst = -1;
+    m_dirtyLast = -1;
+}
+
+// The points starting from first have been appended, and there are now count points.
+void SplineControlPoints::pointsAppended(int first, int count)
+{
+    if (!m_valid)
+        return;
+    if (first != m_count) {
+        invalidate();
+        return;
+    }
+    // The old last row becomes a regular row.
+    markDirty(qMax(first - 2, 0), count - 2);
+    m_count = count;
+}
+
+// count points starting from index have been changed in place.
+void SplineControlPoints::pointsUpdated(int index, int count)
+{
+    if (!m_valid)
+        return;
+    // A point appears on the right hand side of its own row and the previous one.
+    markDirty(qMax(index - 1, 0), qMin(index + count - 1, m_count - 2));
+}
+
+// Returns the control points for points, which must be the points the cache was notified
+// about. Only the rows around the changed points are solved again.
+const QVector<QPointF> &SplineControlPoints::controlPoints(const XYSeriesColumns &points)
+{
+    if (!m_valid || points.count() != m_count) {
+        m_controlPoints = calculate(points);
+        m_count = points.count();
+        m_dirtyFirst = -1;
+        m_dirtyLast = -1;
+        m_valid = true;
+    } else if (m_dirtyFirst >= 0) {
+        solve(points, m_dirtyFirst, m_dirtyLast);
+        m_dirtyFirst = -1;
+        m_dirtyLast = -1;
+    }
+    return m_controlPoints;
+}
+
+void SplineControlPoints::markDirty(int first, int last)
+{
+    if (first > last)
+        return;
+    if (m_dirtyFirst < 0) {
+        m_dirtyFirst = first;
+        m_dirtyLast = last;
+    } else {
+        m_dirtyFirst = qMin(m_dirtyFirst, first);
+        m_dirtyLast = qMax(m_dirtyLast, last);
+    }
+}
+
+void SplineControlPoints::solve(const XYSeriesColumns &points, int first, int last)
+{
+    const int n = points.count() - 1;
+    first = qMax(first - window, 0);
+    last = qMin(last + window, n - 1);
+    if (first == 0 && last == n - 1) {
+        m_controlPoints = calculate(points);
+        return;
+    }
+    m_controlPoints.resize(2 * n);
+    solveRows(points, m_controlPoints, first, last);
+}
+
+QT_CHARTS_END_NAMESPACE
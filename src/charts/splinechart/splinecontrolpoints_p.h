@@ -0,0 +1,85 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef SPLINECONTROLPOINTS_P_H
+#define SPLINECONTROLPOINTS_P_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <private/xyseriescolumns_p.h>
+#include <QtCore/QPointF>
+#include <QtCore/QVector>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Caches the Bezier control points of a spline through the points of a series. The control
+// points are solved from a tridiagonal system, in which the influence of a point decays by a
+// factor of 2 - sqrt(3) per point. Changed and appended points are therefore solved again
+// only within a window of rows around them, and the rest of the control points is kept.
+class QT_CHARTS_PRIVATE_EXPORT SplineControlPoints
+{
+public:
+    SplineControlPoints();
+
+    static QVector<QPointF> calculate(const QVector<QPointF> &points);
+    static QVector<QPointF> calculate(const XYSeriesColumns &points);
+
+    void invalidate();
+    void pointsAppended(int first, int count);
+    void pointsUpdated(int index, int count);
+    const QVector<QPointF> &controlPoints(const XYSeriesColumns &points);
+
+    // Number of rows solved on both sides of the changed rows. The error caused by keeping
+    // the control points outside the window is below double precision.
+    static const int window = 32;
+
+private:
+    void markDirty(int first, int last);
+    void solve(const XYSeriesColumns &points, int first, int last);
+
+    QVector<QPointF> m_controlPoints;
+    int m_count;
+    int m_dirtyFirst;
+    int m_dirtyLast;
+    bool m_valid;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // SPLINECONTROLPOINTS_P_H
@@ -29,6 +29,7 @@
 
 #include "private/glxyseriesdata_p.h"
 #include "private/abstractdomain_p.h"
+#include "private/qxyseries_p.h"
 #include <QtCharts/QScatterSeries>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -44,7 +45,7 @@ GLXYSeriesDataManager::~GLXYSeriesDataManager()
     cleanup();
 }
 
-void GLXYSeriesDataManager::setPoints(QXYSeries *series, const AbstractDomain *domain)
+GLXYSeriesData *GLXYSeriesDataManager::seriesData(QXYSeries *series)
 {
     GLXYSeriesData *data = m_seriesDataMap.value(series);
     if (!data) {
@@ -74,11 +75,15 @@ void GLXYSeriesDataManager::setPoints(QXYSeries *series, const AbstractDomain *d
         m_seriesDataMap.insert(series, data);
         m_mapDirty = true;
     }
-    QVector<float> &array = data->array;
+    return data;
+}
 
-    bool logAxis = false;
-    bool reverseX = false;
-    bool reverseY = false;
+void GLXYSeriesDataManager::resolveAxes(QXYSeries *series, bool &logAxis, bool &reverseX,
+                                        bool &reverseY)
+{
+    logAxis = false;
+    reverseX = false;
+    reverseY = false;
     foreach (QAbstractAxis* axis, series->attachedAxes()) {
         if (axis->type() == QAbstractAxis::AxisTypeLogValue) {
             logAxis = true;
@@ -93,13 +98,42 @@ void GLXYSeriesDataManager::setPoints(QXYSeries *series, const AbstractDomain *d
                 break;
         }
     }
-    int count = series->count();
+}
+
+// Regular value axes, so we can do the math easily on shaders.
+void GLXYSeriesDataManager::setTransform(GLXYSeriesData *data, const AbstractDomain *domain,
+                                         bool reverseX, bool reverseY)
+{
+    QMatrix4x4 matrix;
+    if (reverseX)
+        matrix.scale(-1.0, 1.0);
+    if (reverseY)
+        matrix.scale(1.0, -1.0);
+    data->matrix = matrix;
+    data->min = QVector2D(domain->minX(), domain->minY());
+    data->delta = QVector2D((domain->maxX() - domain->minX()) / 2.0f,
+                            (domain->maxY() - domain->minY()) / 2.0f);
+}
+
+void GLXYSeriesDataManager::setPoints(QXYSeries *series, const AbstractDomain *domain)
+{
+    GLXYSeriesData *data = seriesData(series);
+    QVector<float> &array = data->array;
+
+    bool logAxis;
+    bool reverseX;
+    bool reverseY;
+    resolveAxes(series, logAxis, reverseX, reverseY);
+
+    // The values are read from the series storage directly, whether it is a point vector
+    // or separate x and y columns.
+    const XYSeriesColumns columns = series->d_func()->columns();
+    int count = columns.count();
     int index = 0;
     array.resize(count * 2);
-    QMatrix4x4 matrix;
     if (logAxis) {
         // Use domain to resolve geometry points. Not as fast as shaders, but simpler that way
-        QVector<QPointF> geometryPoints = domain->calculateGeometryPoints(series->pointsVector());
+        QVector<QPointF> geometryPoints = domain->calculateColumnGeometryPoints(columns);
         const float height = domain->size().height();
         if (geometryPoints.size()) {
             for (int i = 0; i < count; i++) {
@@ -116,23 +150,46 @@ void GLXYSeriesDataManager::setPoints(QXYSeries *series, const AbstractDomain *d
         }
         data->min = QVector2D(0, 0);
         data->delta = QVector2D(domain->size().width() / 2.0f, domain->size().height() / 2.0f);
+        data->matrix = QMatrix4x4();
     } else {
-        // Regular value axes, so we can do the math easily on shaders.
-        if (reverseX)
-            matrix.scale(-1.0, 1.0);
-        if (reverseY)
-            matrix.scale(1.0, -1.0);
-        QVector<QPointF> seriesPoints = series->pointsVector();
-        for (int i = 0; i < count; i++) {
-            const QPointF &point = seriesPoints.at(i);
-            array[index++] = float(point.x());
-            array[index++] = float(point.y());
-        }
-        data->min = QVector2D(domain->minX(), domain->minY());
-        data->delta = QVector2D((domain->maxX() - domain->minX()) / 2.0f,
-                                (domain->maxY() - domain->minY()) / 2.0f);
+        columns.copyFloats(array.data());
+        setTransform(data, domain, reverseX, reverseY);
     }
-    data->matrix = matrix;
+    data->logAxis = logAxis;
+    data->dirty = true;
+    data->setAllDirty();
+}
+
+// Updates the vertices of count points starting at index, which have either been appended
+// or changed in place, and the transformation of the series. Only the updated vertices are
+// uploaded to the GPU. A count of zero only updates the transformation, as the vertices of
+// regular value axes do not depend on the domain. Falls back to setPoints() if the vertices
+// cannot be updated in place.
+void GLXYSeriesDataManager::updatePoints(QXYSeries *series, const AbstractDomain *domain,
+                                         int index, int count)
+{
+    GLXYSeriesData *data = m_seriesDataMap.value(series);
+    bool logAxis;
+    bool reverseX;
+    bool reverseY;
+    resolveAxes(series, logAxis, reverseX, reverseY);
+
+    const XYSeriesColumns columns = series->d_func()->columns();
+    const int oldCount = data ? data->array.size() / 2 : 0;
+    const int newCount = columns.count();
+    const bool appended = oldCount == index && index + count == newCount;
+    const bool changed = oldCount == newCount && index + count <= newCount;
+    if (!data || logAxis || data->logAxis || (!appended && !changed)) {
+        setPoints(series, domain);
+        return;
+    }
+
+    if (count > 0) {
+        data->array.resize(newCount * 2);
+        columns.mid(index, count).copyFloats(data->array.data() + 2 * index);
+        data->addDirtyRange(index, count);
+    }
+    setTransform(data, domain, reverseX, reverseY);
     data->dirty = true;
 }
 
@@ -46,6 +46,9 @@
 #include <QtGui/QVector3D>
 #include <QtGui/QVector2D>
 #include <QtGui/QMatrix4x4>
+#ifndef QT_NO_OPENGL
+#include <QtGui/QOpenGLBuffer>
+#endif
 
 QT_CHARTS_BEGIN_NAMESPACE
 
@@ -54,26 +57,88 @@ class AbstractDomain;
 struct GLXYSeriesData {
     QVector<float> array;
     bool dirty;
+    // Range of vertices in array that changed since the data was last uploaded. A negative
+    // dirtyCount means that the whole array has to be uploaded.
+    int dirtyIndex;
+    int dirtyCount;
     QVector3D color;
     float width;
     QAbstractSeries::SeriesType type;
     QVector2D min;
     QVector2D delta;
     bool visible;
+    bool logAxis;
     QMatrix4x4 matrix;
 public:
+    GLXYSeriesData()
+        : dirty(false),
+          dirtyIndex(0),
+          dirtyCount(-1),
+          width(0.0f),
+          type(QAbstractSeries::SeriesTypeLine),
+          visible(true),
+          logAxis(false)
+    {
+    }
+
     GLXYSeriesData &operator=(const GLXYSeriesData &data) {
         array = data.array;
         dirty = data.dirty;
+        dirtyIndex = data.dirtyIndex;
+        dirtyCount = data.dirtyCount;
         color = data.color;
         width = data.width;
         type = data.type;
         min = data.min;
         delta = data.delta;
         visible = data.visible;
+        logAxis = data.logAxis;
         matrix = data.matrix;
         return *this;
     }
+
+    void addDirtyRange(int index, int count) {
+        if (dirtyCount < 0 || count <= 0)
+            return;
+        if (dirtyCount == 0) {
+            dirtyIndex = index;
+            dirtyCount = count;
+        } else {
+            const int end = qMax(dirtyIndex + dirtyCount, index + count);
+            dirtyIndex = qMin(dirtyIndex, index);
+            dirtyCount = end - dirtyIndex;
+        }
+    }
+    void setAllDirty() { dirtyIndex = 0; dirtyCount = -1; }
+    void clearDirtyRange() { dirtyIndex = 0; dirtyCount = 0; }
+
+#ifndef QT_NO_OPENGL
+    // Uploads the vertices that changed since the last upload. The buffer is allocated with room
+    // to spare, so that appended vertices can be written into it with glBufferSubData() instead
+    // of reallocating and uploading the whole buffer. This is needed by the qml side, so it must
+    // be inline.
+    void upload(QOpenGLBuffer *vbo, bool newBuffer) {
+        const int vertexCount = array.size() / 2;
+        const int vertexSize = 2 * int(sizeof(float));
+        const int size = vertexCount * vertexSize;
+        int index = dirtyIndex;
+        int count = dirtyCount;
+        const int bufferSize = newBuffer ? -1 : vbo->size();
+        if (bufferSize < size || bufferSize > 4 * size) {
+            vbo->allocate(size + size / 2);
+            index = 0;
+            count = vertexCount;
+        } else if (count < 0) {
+            index = 0;
+            count = vertexCount;
+        }
+        count = qMin(count, vertexCount - index);
+        if (count > 0)
+            vbo->write(index * vertexSize, array.constData() + 2 * index, count * vertexSize);
+        dirty = false;
+        clearDirtyRange();
+    }
+#endif
 };
 
 typedef QMap<const QXYSeries *, GLXYSeriesData *> GLXYDataMap;
@@ -88,6 +153,7 @@ public:
     ~GLXYSeriesDataManager();
 
     void setPoints(QXYSeries *series, const AbstractDomain *domain);
+    void updatePoints(QXYSeries *series, const AbstractDomain *domain, int index, int count);
 
     void removeSeries(const QXYSeries *series);
 
@@ -97,8 +163,10 @@ public:
     bool mapDirty() const { return m_mapDirty; }
     void clearAllDirty() {
         m_mapDirty = false;
-        foreach (GLXYSeriesData *data, m_seriesDataMap.values())
+        foreach (GLXYSeriesData *data, m_seriesDataMap.values()) {
             data->dirty = false;
+            data->clearDirtyRange();
+        }
     }
     void handleAxisReverseChanged(const QList<QAbstractSeries *> &seriesList);
 
@@ -114,6 +182,11 @@ Q_SIGNALS:
     void seriesRemoved(const QXYSeries *series);
 
 private:
+    GLXYSeriesData *seriesData(QXYSeries *series);
+    static void resolveAxes(QXYSeries *series, bool &logAxis, bool &reverseX, bool &reverseY);
+    static void setTransform(GLXYSeriesData *data, const AbstractDomain *domain,
+                             bool reverseX, bool reverseY);
+
     GLXYDataMap m_seriesDataMap;
     bool m_mapDirty;
 };
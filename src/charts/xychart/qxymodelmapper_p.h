@@ -72,6 +72,7 @@ public Q_SLOTS:
 
     // for the series
     void handlePointAdded(int pointPos);
+    void handlePointsAdded(int pointPos, int count);
     void handlePointRemoved(int pointPos);
     void handlePointsRemoved(int pointPos, int count);
     void handlePointReplaced(int pointPos);
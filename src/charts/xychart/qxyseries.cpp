@@ -432,6 +432,32 @@ QT_CHARTS_BEGIN_NAMESPACE
     The corresponding signal handler is \c onPointRemoved().
 */
 
+/*!
+    \fn void QXYSeries::pointsAdded(int index, int count)
+    \since 5.11
+    This signal is emitted when the number of points specified by \a count
+    is added starting at the position specified by \a index.
+    \sa append()
+*/
+
+/*!
+    \qmlsignal XYSeries::pointsAdded(int index, int count)
+    \since 5.11
+    This signal is emitted when the number of points specified by \a count
+    is added starting at the position specified by \a index.
+
+    The corresponding signal handler is \c onPointsAdded().
+*/
+
+/*!
+    \fn void QXYSeries::pointsChanged(int index, int count)
+    \since 5.11
+    This signal is emitted when the values of the number of points specified by
+    \a count starting at the position specified by \a index have been changed
+    in the external data of the series.
+    \sa updateExternalData()
+*/
+
 /*!
     \fn void QXYSeries::colorChanged(QColor color)
     This signal is emitted when the line (pen) color changes to \a color.
@@ -527,7 +553,9 @@ void QXYSeries::append(const QPointF &point)
     Q_D(QXYSeries);
 
     if (isValidValue(point)) {
+        d->detachColumns();
         d->m_points << point;
+        d->pointsAppended(d->m_points.count() - 1);
         emit pointAdded(d->m_points.count() - 1);
     }
 }
@@ -535,6 +563,9 @@ void QXYSeries::append(const QPointF &point)
 /*!
    \overload
    Adds the list of data points specified by \a points to the series.
+   Emits QXYSeries::pointAdded() for each point.
+   \note Appending a vector of points is much faster, because it only emits
+   QXYSeries::pointsAdded() once.
  */
 void QXYSeries::append(const QList<QPointF> &points)
 {
@@ -542,6 +573,84 @@ void QXYSeries::append(const QList<QPointF> &points)
         append(point);
 }
 
+/*!
+   \since 5.11
+   Adds the vector of data points specified by \a points to the series.
+   Emits QXYSeries::pointsAdded() once for all the points.
+   \sa append(), pointsAdded()
+ */
+void QXYSeries::appendPoints(const QVector<QPointF> &points)
+{
+    Q_D(QXYSeries);
+    d->detachColumns();
+    const int index = d->m_points.count();
+    d->m_points.reserve(index + points.count());
+    for (int i = 0; i < points.count(); i++) {
+        if (isValidValue(points.at(i)))
+            d->m_points.append(points.at(i));
+    }
+    if (d->m_points.count() > index) {
+        d->pointsAppended(index);
+        emit pointsAdded(index, d->m_points.count() - index);
+    }
+}
+
+/*!
+   \overload
+   \since 5.11
+   Adds \a count data points to the series. The x-coordinates of the points are read from
+   the array \a x and the y-coordinates from the array \a y. Both arrays must contain at
+   least \a count values.
+   Emits QXYSeries::pointsAdded() once for all the points.
+   \sa pointsAdded()
+ */
+void QXYSeries::append(const qreal *x, const qreal *y, int count)
+{
+    Q_D(QXYSeries);
+    d->detachColumns();
+    const int index = d->m_points.count();
+    d->m_points.reserve(index + qMax(count, 0));
+    for (int i = 0; i < count; i++) {
+        if (isValidValue(x[i], y[i]))
+            d->m_points.append(QPointF(x[i], y[i]));
+    }
+    if (d->m_points.count() > index) {
+        d->pointsAppended(index);
+        emit pointsAdded(index, d->m_points.count() - index);
+    }
+}
+
+/*!
+   \since 5.11
+   Adds the vector of data points specified by \a points to the end of the series
+   and removes the number of points specified by \a removeCount from the beginning
+   of the series. This is useful for keeping a fixed size window of the latest
+   data points of a data stream.
+
+   Emits QXYSeries::pointsReplaced() once, or QXYSeries::pointsAdded() if no
+   points are removed.
+   \sa appendPoints(), removePoints()
+ */
+void QXYSeries::appendAndRemoveFirst(const QVector<QPointF> &points, int removeCount)
+{
+    Q_D(QXYSeries);
+    removeCount = qBound(0, removeCount, d->count());
+    if (removeCount == 0) {
+        appendPoints(points);
+        return;
+    }
+
+    d->detachColumns();
+    d->m_points.remove(0, removeCount);
+    d->m_points.reserve(d->m_points.count() + points.count());
+    for (int i = 0; i < points.count(); i++) {
+        if (isValidValue(points.at(i)))
+            d->m_points.append(points.at(i));
+    }
+    d->pointsReset();
+    emit pointsReplaced();
+}
+
 /*!
     Replaces the point with the coordinates \a oldX and \a oldY with the point
     with the coordinates \a newX and \a newY. Does nothing if the old point does
@@ -562,7 +671,7 @@ void QXYSeries::replace(qreal oldX, qreal oldY, qreal newX, qreal newY)
 void QXYSeries::replace(const QPointF &oldPoint, const QPointF &newPoint)
 {
     Q_D(QXYSeries);
-    int index = d->m_points.indexOf(oldPoint);
+    int index = d->indexOf(oldPoint);
     if (index == -1)
         return;
     replace(index, newPoint);
@@ -587,7 +696,9 @@ void QXYSeries::replace(int index, const QPointF &newPoint)
 {
     Q_D(QXYSeries);
     if (isValidValue(newPoint)) {
+        d->detachColumns();
         d->m_points[index] = newPoint;
+        d->pointsUpdated(index, 1);
         emit pointReplaced(index);
     }
 }
@@ -615,10 +726,140 @@ void QXYSeries::replace(QList<QPointF> points)
 void QXYSeries::replace(QVector<QPointF> points)
 {
     Q_D(QXYSeries);
+    d->m_columns = XYSeriesColumns();
     d->m_points = points;
+    d->pointsReset();
+    emit pointsReplaced();
+}
+
+/*!
+  \since 5.11
+  Replaces the current points with points that have the x-coordinates specified by
+  \a xValues and the y-coordinates specified by \a yValues. If the vectors differ in
+  size, the extra values of the longer vector are ignored.
+
+  The series stores the values in separate x and y columns that share their data with
+  the given vectors, so the values are neither copied nor converted to points. The
+  geometry, axis ranges, and OpenGL vertex data are calculated directly from the
+  columns. The values are not validated, so they should not contain NaN or infinite
+  values.
+
+  Functions that modify the points of the series convert the columns back to points.
+  Functions that return points, such as at() and pointsVector(), create a copy of the
+  values as points the first time they are called.
+
+  Emits QXYSeries::pointsReplaced() when the points have been replaced.
+  \sa pointsReplaced()
+*/
+void QXYSeries::replace(const QVector<double> &xValues, const QVector<double> &yValues)
+{
+    Q_D(QXYSeries);
+    d->m_columns = XYSeriesColumns(xValues, yValues);
+    d->m_points.clear();
+    d->pointsReset();
     emit pointsReplaced();
 }
 
+/*!
+  \overload
+  \since 5.11
+  Replaces the current points with points that have the single precision x-coordinates
+  specified by \a xValues and y-coordinates specified by \a yValues. Storing the values
+  as single precision halves the memory used by the series.
+*/
+void QXYSeries::replace(const QVector<float> &xValues, const QVector<float> &yValues)
+{
+    Q_D(QXYSeries);
+    d->m_columns = XYSeriesColumns(xValues, yValues);
+    d->m_points.clear();
+    d->pointsReset();
+    emit pointsReplaced();
+}
+
+/*!
+  \since 5.11
+  Replaces the current points with \a count points read from memory owned by the
+  application. The x-coordinates are read from \a xValues and the y-coordinates from
+  \a yValues. \a xStride and \a yStride specify the distance between consecutive
+  values in bytes, so the values can also be read from an array of structures, or
+  from a memory-mapped file.
+
+  The values are not copied. The memory must stay valid until the series is attached
+  to other data or destroyed, and the values should not be NaN or infinite. Call
+  updateExternalData() after changing the values. If the memory is read the same way
+  as before and \a count has grown, the new values are treated as appended points
+  and QXYSeries::pointsAdded() is emitted. Otherwise QXYSeries::pointsReplaced() is
+  emitted.
+
+  Functions that return points, such as at() and pointsVector(), create a copy of the
+  values as points when they are called. Functions that modify the points of the
+  series copy the values into the series and detach it from the external data.
+  \sa updateExternalData(), replace()
+*/
+void QXYSeries::setExternalData(const double *xValues, const double *yValues, int count,
+                                int xStride, int yStride)
+{
+    Q_D(QXYSeries);
+    d->setExternalColumns(XYSeriesColumns::fromRawData(xValues, xStride, XYSeriesColumns::Double,
+                                                       yValues, yStride, XYSeriesColumns::Double,
+                                                       count));
+}
+
+/*!
+  \overload
+  \since 5.11
+  Attaches the series to the single precision values \a xValues and \a yValues.
+  \a count, \a xStride, and \a yStride are used as above.
+*/
+void QXYSeries::setExternalData(const float *xValues, const float *yValues, int count,
+                                int xStride, int yStride)
+{
+    Q_D(QXYSeries);
+    d->setExternalColumns(XYSeriesColumns::fromRawData(xValues, xStride, XYSeriesColumns::Float,
+                                                       yValues, yStride, XYSeriesColumns::Float,
+                                                       count));
+}
+
+/*!
+  \overload
+  \since 5.11
+  Attaches the series to the double precision x-coordinates \a xValues, typically
+  timestamps, and the single precision y-coordinates \a yValues. \a count,
+  \a xStride, and \a yStride are used as above.
+*/
+void QXYSeries::setExternalData(const double *xValues, const float *yValues, int count,
+                                int xStride, int yStride)
+{
+    Q_D(QXYSeries);
+    d->setExternalColumns(XYSeriesColumns::fromRawData(xValues, xStride, XYSeriesColumns::Double,
+                                                       yValues, yStride, XYSeriesColumns::Float,
+                                                       count));
+}
+
+/*!
+  \since 5.11
+  Tells the series that the external values of \a count points starting at the
+  position specified by \a index have changed. Only the geometry of the changed
+  points is recalculated. Does nothing if the series is not attached to external data.
+
+  Emits QXYSeries::pointsChanged().
+  \sa setExternalData()
+*/
+void QXYSeries::updateExternalData(int index, int count)
+{
+    Q_D(QXYSeries);
+    if (!d->m_columns.isExternal())
+        return;
+    index = qBound(0, index, d->m_columns.count());
+    count = qMin(count, d->m_columns.count() - index);
+    if (count <= 0)
+        return;
+    // The point copy no longer matches the values.
+    d->m_points.clear();
+    d->pointsUpdated(index, count);
+    emit pointsChanged(index, count);
+}
+
 /*!
   Removes the point that has the coordinates \a x and \a y from the series.
   \sa pointRemoved()
@@ -635,7 +876,7 @@ void QXYSeries::remove(qreal x, qreal y)
 void QXYSeries::remove(const QPointF &point)
 {
     Q_D(QXYSeries);
-    int index = d->m_points.indexOf(point);
+    int index = d->indexOf(point);
     if (index == -1)
         return;
     remove(index);
@@ -648,7 +889,9 @@ void QXYSeries::remove(const QPointF &point)
 void QXYSeries::remove(int index)
 {
     Q_D(QXYSeries);
+    d->detachColumns();
     d->m_points.remove(index);
+    d->pointsReset();
     emit pointRemoved(index);
 }
 
@@ -663,7 +906,9 @@ void QXYSeries::removePoints(int index, int count)
     // remove(qreal, qreal) overload in some implicit casting cases.
     Q_D(QXYSeries);
     if (count > 0) {
+        d->detachColumns();
         d->m_points.remove(index, count);
+        d->pointsReset();
         emit pointsRemoved(index, count);
     }
 }
@@ -677,8 +922,10 @@ void QXYSeries::insert(int index, const QPointF &point)
 {
     Q_D(QXYSeries);
     if (isValidValue(point)) {
+        d->detachColumns();
         index = qMax(0, qMin(index, d->m_points.size()));
         d->m_points.insert(index, point);
+        d->pointsReset();
         emit pointAdded(index);
     }
 }
@@ -690,7 +937,7 @@ void QXYSeries::insert(int index, const QPointF &point)
 void QXYSeries::clear()
 {
     Q_D(QXYSeries);
-    removePoints(0, d->m_points.size());
+    removePoints(0, d->count());
 }
 
 /*!
@@ -700,7 +947,7 @@ void QXYSeries::clear()
 QList<QPointF> QXYSeries::points() const
 {
     Q_D(const QXYSeries);
-    return d->m_points.toList();
+    return d->points().toList();
 }
 
 /*!
@@ -710,7 +957,7 @@ QList<QPointF> QXYSeries::points() const
 QVector<QPointF> QXYSeries::pointsVector() const
 {
     Q_D(const QXYSeries);
-    return d->m_points;
+    return d->points();
 }
 
 /*!
@@ -720,7 +967,7 @@ QVector<QPointF> QXYSeries::pointsVector() const
 const QPointF &QXYSeries::at(int index) const
 {
     Q_D(const QXYSeries);
-    return d->m_points.at(index);
+    return d->points().at(index);
 }
 
 /*!
@@ -729,7 +976,35 @@ const QPointF &QXYSeries::at(int index) const
 int QXYSeries::count() const
 {
     Q_D(const QXYSeries);
-    return d->m_points.count();
+    return d->count();
+}
+
+/*!
+    \since 5.11
+    Returns the smallest and the largest y-coordinate of the points whose x-coordinate is
+    between \a fromX and \a toX, inclusive. If there are no such points, returns a pair of
+    zeros.
+
+    If \a ok is not \c nullptr, \c{*ok} is set to \c true if there are such points, and to
+    \c false otherwise.
+
+    The series maintains an index of its value ranges, so if the x-coordinates of the
+    points are in ascending order, the range is found in logarithmic time. This makes
+    it cheap to fit the y-axis to the visible part of the series, for example after
+    zooming or scrolling. The index is rebuilt after points are inserted or removed
+    anywhere else than at the end of the series.
+*/
+QPair<qreal, qreal> QXYSeries::yRange(qreal fromX, qreal toX, bool *ok) const
+{
+    Q_D(const QXYSeries);
+    qreal minY = 0;
+    qreal maxY = 0;
+    const bool found = d->m_rangeIndex.yRange(d->columns(), fromX, toX, minY, maxY);
+    if (ok)
+        *ok = found;
+    if (!found)
+        return QPair<qreal, qreal>(0, 0);
+    return qMakePair(minY, maxY);
 }
 
 
@@ -936,27 +1211,103 @@ void QXYSeriesPrivate::initializeDomain()
     qreal maxX(1);
     qreal maxY(1);
 
-    Q_Q(QXYSeries);
+    m_rangeIndex.bounds(columns(), minX, maxX, minY, maxY);
 
-    const QVector<QPointF> &points = q->pointsVector();
-
-    if (!points.isEmpty()) {
-        minX = points[0].x();
-        minY = points[0].y();
-        maxX = minX;
-        maxY = minY;
-
-        for (int i = 0; i < points.count(); i++) {
-            qreal x = points[i].x();
-            qreal y = points[i].y();
-            minX = qMin(minX, x);
-            minY = qMin(minY, y);
-            maxX = qMax(maxX, x);
-            maxY = qMax(maxY, y);
-        }
+    domain()->setRange(minX, maxX, minY, maxY);
+}
+
+QPointF QXYSeriesPrivate::pointAt(int index) const
+{
+    return m_columns.isNull() ? m_points.at(index) : m_columns.at(index);
+}
+
+const QVector<QPointF> &QXYSeriesPrivate::points() const
+{
+    if (!m_columns.isNull() && m_points.count() != m_columns.count())
+        m_points = m_columns.toPoints();
+    return m_points;
+}
+
+// Returns the values of the series as columns, referring to the points if the series
+// is not stored in columns.
+XYSeriesColumns QXYSeriesPrivate::columns() const
+{
+    return m_columns.isNull() ? XYSeriesColumns(m_points) : m_columns;
+}
+
+// Returns the index of the first point equal to point, or -1. The points are looked up in the
+// columns, so that a series stored in columns is only converted to points if a point is
+// actually modified.
+int QXYSeriesPrivate::indexOf(const QPointF &point) const
+{
+    if (m_columns.isNull())
+        return m_points.indexOf(point);
+    for (int i = 0; i < m_columns.count(); i++) {
+        if (m_columns.at(i) == point)
+            return i;
     }
+    return -1;
+}
 
-    domain()->setRange(minX, maxX, minY, maxY);
+// Converts a series stored in columns back to points before the points are modified.
+void QXYSeriesPrivate::detachColumns()
+{
+    if (!m_columns.isNull()) {
+        points();
+        m_columns = XYSeriesColumns();
+    }
+}
+
+void QXYSeriesPrivate::setExternalColumns(const XYSeriesColumns &columns)
+{
+    Q_Q(QXYSeries);
+    const int oldCount = count();
+    const bool grown = m_columns.isExternal() && m_columns.sharesColumns(columns)
+            && columns.count() > oldCount;
+    m_columns = columns;
+    m_points.clear();
+    if (grown) {
+        pointsAppended(oldCount);
+        emit q->pointsAdded(oldCount, columns.count() - oldCount);
+    } else {
+        pointsReset();
+        emit q->pointsReplaced();
+    }
+}
+
+// Called after the points starting from first have been appended to the series.
+void QXYSeriesPrivate::pointsAppended(int first)
+{
+    m_rangeIndex.pointsAppended(columns(), first);
+}
+
+// Called after count points starting from index have been changed in place.
+void QXYSeriesPrivate::pointsUpdated(int index, int count)
+{
+    m_rangeIndex.pointsChanged(columns(), index, count);
+}
+
+// Called after any other modification of the points.
+void QXYSeriesPrivate::pointsReset()
+{
+    m_rangeIndex.invalidate();
+    m_pointLabelCache.invalidate();
+}
+
+// Finds the range of points from first to last that is needed to draw the x-range from fromX
+// to toX, including margin points outside the range on both sides. Returns false if the
+// x-values are not sorted, as the range cannot be found by binary search then.
+bool QXYSeriesPrivate::coveringRange(qreal fromX, qreal toX, int margin,
+                                     int &first, int &last) const
+{
+    const XYSeriesColumns values = columns();
+    if (values.count() == 0 || !m_rangeIndex.isSortedX(values))
+        return false;
+    first = qMax(XYRangeIndex::lowerBound(values, fromX) - margin, 0);
+    last = qMin(XYRangeIndex::upperBound(values, toX) - 1 + margin, values.count() - 1);
+    if (last < first)
+        last = first - 1;
+    return true;
 }
 
 QList<QLegendMarker*> QXYSeriesPrivate::createLegendMarkers(QLegend* legend)
@@ -998,35 +1349,52 @@ void QXYSeriesPrivate::initializeAnimations(QtCharts::QChart::AnimationOptions o
     QAbstractSeriesPrivate::initializeAnimations(options, duration, curve);
 }
 
+// Draws the labels of the points, positioned at the geometry points. The first geometry
+// point belongs to the series point at firstIndex.
 void QXYSeriesPrivate::drawSeriesPointLabels(QPainter *painter, const QVector<QPointF> &points,
-                                             const int offset)
+                                             const int offset, const int firstIndex)
 {
     if (points.size() == 0)
         return;
 
-    static const QString xPointTag(QLatin1String("@xPoint"));
-    static const QString yPointTag(QLatin1String("@yPoint"));
     const int labelOffset = offset + 2;
 
     painter->setFont(m_pointLabelsFont);
     painter->setPen(QPen(m_pointLabelsColor));
     QFontMetrics fm(painter->font());
+    m_pointLabelCache.setFormat(m_pointLabelsFormat, m_pointLabelsFont, presenter());
+
+    // Labels outside the clip rect are not drawn, and neither are labels that would overlap
+    // labels drawn before them.
+    const bool clipped = painter->hasClipping();
+    const QRectF clipRect = clipped ? painter->clipBoundingRect() : QRectF();
+    XYLabelCollisionGrid drawnLabels(4 * fm.height(), fm.height());
+
+    m_pointLabelCache.beginPaint();
     // m_points is used for the label here as it has the series point information
     // points variable passed is used for positioning because it has the coordinates
-    const int pointCount = qMin(points.size(), m_points.size());
+    const int pointCount = qMin(points.size(), count() - firstIndex);
     for (int i(0); i < pointCount; i++) {
-        QString pointLabel = m_pointLabelsFormat;
-        pointLabel.replace(xPointTag, presenter()->numberToString(m_points.at(i).x()));
-        pointLabel.replace(yPointTag, presenter()->numberToString(m_points.at(i).y()));
-
         // Position text in relation to the point
-        int pointLabelWidth = fm.width(pointLabel);
-        QPointF position(points.at(i));
-        position.setX(position.x() - pointLabelWidth / 2);
-        position.setY(position.y() - labelOffset);
+        const QPointF &point = points.at(i);
+        const qreal baseline = point.y() - labelOffset;
+        if (clipped && (baseline - fm.ascent() > clipRect.bottom()
+                        || baseline + fm.descent() < clipRect.top())) {
+            continue;
+        }
+
+        int pointLabelWidth;
+        const QString &pointLabel = m_pointLabelCache.label(firstIndex + i,
+                                                            pointAt(firstIndex + i), fm,
+                                                            &pointLabelWidth);
+        const QRectF labelRect(point.x() - pointLabelWidth / 2, baseline - fm.ascent(),
+                               pointLabelWidth, fm.height());
+        if ((clipped && !clipRect.intersects(labelRect)) || !drawnLabels.insert(labelRect))
+            continue;
 
-        painter->drawText(position, pointLabel);
+        painter->drawText(QPointF(labelRect.left(), baseline), pointLabel);
     }
+    m_pointLabelCache.endPaint();
 }
 
 #include "moc_qxyseries.cpp"
@@ -32,6 +32,7 @@
 
 #include <QtCharts/QChartGlobal>
 #include <QtCharts/QAbstractSeries>
+#include <QtCore/QPair>
 #include <QtGui/QPen>
 #include <QtGui/QBrush>
 
@@ -63,6 +64,9 @@ public:
     void append(qreal x, qreal y);
     void append(const QPointF &point);
     void append(const QList<QPointF> &points);
+    void appendPoints(const QVector<QPointF> &points);
+    void append(const qreal *x, const qreal *y, int count);
+    void appendAndRemoveFirst(const QVector<QPointF> &points, int removeCount);
     void replace(qreal oldX, qreal oldY, qreal newX, qreal newY);
     void replace(const QPointF &oldPoint, const QPointF &newPoint);
     void replace(int index, qreal newX, qreal newY);
@@ -78,6 +82,7 @@ public:
     QList<QPointF> points() const;
     QVector<QPointF> pointsVector() const;
     const QPointF &at(int index) const;
+    QPair<qreal, qreal> yRange(qreal fromX, qreal toX, bool *ok = nullptr) const;
 
     QXYSeries &operator << (const QPointF &point);
     QXYSeries &operator << (const QList<QPointF> &points);
@@ -111,6 +116,16 @@ public:
 
     void replace(QList<QPointF> points);
     void replace(QVector<QPointF> points);
+    void replace(const QVector<double> &xValues, const QVector<double> &yValues);
+    void replace(const QVector<float> &xValues, const QVector<float> &yValues);
+
+    void setExternalData(const double *xValues, const double *yValues, int count,
+                         int xStride = int(sizeof(double)), int yStride = int(sizeof(double)));
+    void setExternalData(const float *xValues, const float *yValues, int count,
+                         int xStride = int(sizeof(float)), int yStride = int(sizeof(float)));
+    void setExternalData(const double *xValues, const float *yValues, int count,
+                         int xStride = int(sizeof(double)), int yStride = int(sizeof(float)));
+    void updateExternalData(int index, int count);
 
 Q_SIGNALS:
     void clicked(const QPointF &point);
@@ -130,6 +145,8 @@ Q_SIGNALS:
     void pointLabelsClippingChanged(bool clipping);
     void pointsRemoved(int index, int count);
     void penChanged(const QPen &pen);
+    void pointsAdded(int index, int count);
+    void pointsChanged(int index, int count);
 
 private:
     Q_DECLARE_PRIVATE(QXYSeries)
@@ -137,6 +154,8 @@ private:
     friend class QXYLegendMarkerPrivate;
     friend class XYLegendMarker;
     friend class XYChart;
+    friend class GLXYSeriesDataManager;
+    friend class QAreaSeriesPrivate;
 };
 
 QT_CHARTS_END_NAMESPACE
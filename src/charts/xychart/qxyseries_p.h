@@ -40,6 +40,9 @@
 #define QXYSERIES_P_H
 
 #include <private/qabstractseries_p.h>
+#include <private/xyseriescolumns_p.h>
+#include <private/xyrangeindex_p.h>
+#include <private/xypointlabelcache_p.h>
 #include <QtCharts/private/qchartglobal_p.h>
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -65,13 +68,32 @@ public:
     QAbstractAxis* createDefaultAxis(Qt::Orientation orientation) const;
 
     void drawSeriesPointLabels(QPainter *painter, const QVector<QPointF> &points,
-                               const int offset = 0);
+                               const int offset = 0, const int firstIndex = 0);
+
+    int count() const { return m_columns.isNull() ? m_points.count() : m_columns.count(); }
+    QPointF pointAt(int index) const;
+    const QVector<QPointF> &points() const;
+    XYSeriesColumns columns() const;
+    int indexOf(const QPointF &point) const;
+    void detachColumns();
+    void setExternalColumns(const XYSeriesColumns &columns);
+    bool coveringRange(qreal fromX, qreal toX, int margin, int &first, int &last) const;
+
+    virtual void pointsAppended(int first);
+    virtual void pointsUpdated(int index, int count);
+    virtual void pointsReset();
 
 Q_SIGNALS:
     void updated();
 
 protected:
-    QVector<QPointF> m_points;
+    // If m_columns is set, the series data is stored in it and m_points is only
+    // a cache created on demand for the point based API.
+    mutable QVector<QPointF> m_points;
+    XYSeriesColumns m_columns;
+    // Value ranges of the points, kept up to date by the functions that modify them.
+    mutable XYRangeIndex m_rangeIndex;
+    XYPointLabelCache m_pointLabelCache;
     QPen m_pen;
     QBrush m_brush;
     bool m_pointsVisible;
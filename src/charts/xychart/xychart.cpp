@@ -38,6 +38,8 @@
 #include <private/qabstractaxis_p.h>
 #include <QtGui/QPainter>
 #include <QtCore/QAbstractItemModel>
+#include <QtCore/QAbstractAnimation>
+#include <QtCore/QtMath>
 
 
 QT_CHARTS_BEGIN_NAMESPACE
@@ -46,13 +48,21 @@ XYChart::XYChart(QXYSeries *series, QGraphicsItem *item):
       ChartItem(series->d_func(),item),
       m_series(series),
       m_animation(0),
-      m_dirty(true)
+      m_dirty(true),
+      m_streaming(false),
+      m_pointsOffset(0),
+      m_pointsCulled(false),
+      m_newPointsOffset(0),
+      m_newPointsCulled(false),
+      m_cullingMargin(-1)
 {
     QObject::connect(series, SIGNAL(pointReplaced(int)), this, SLOT(handlePointReplaced(int)));
     QObject::connect(series, SIGNAL(pointsReplaced()), this, SLOT(handlePointsReplaced()));
     QObject::connect(series, SIGNAL(pointAdded(int)), this, SLOT(handlePointAdded(int)));
+    QObject::connect(series, SIGNAL(pointsAdded(int, int)), this, SLOT(handlePointsAdded(int, int)));
     QObject::connect(series, SIGNAL(pointRemoved(int)), this, SLOT(handlePointRemoved(int)));
     QObject::connect(series, SIGNAL(pointsRemoved(int, int)), this, SLOT(handlePointsRemoved(int, int)));
+    QObject::connect(series, SIGNAL(pointsChanged(int, int)), this, SLOT(handlePointsChanged(int, int)));
     QObject::connect(this, SIGNAL(clicked(QPointF)), series, SIGNAL(clicked(QPointF)));
     QObject::connect(this, SIGNAL(hovered(QPointF,bool)), series, SIGNAL(hovered(QPointF,bool)));
     QObject::connect(this, SIGNAL(pressed(QPointF)), series, SIGNAL(pressed(QPointF)));
@@ -67,6 +77,85 @@ void XYChart::setGeometryPoints(const QVector<QPointF> &points)
     m_points = points;
 }
 
+// Enables culling of the points outside the x-range of the domain. The geometry points are
+// then only calculated for the points in view and margin points on both sides of it.
+// A negative margin disables culling.
+void XYChart::setCullingMargin(int margin)
+{
+    m_cullingMargin = margin;
+}
+
+// Returns the values the geometry points are calculated from. If the points can be culled,
+// only the values in view are returned, and offset is set to the index of the first one.
+// Culling requires points sorted by x on cartesian axes, and is not used while an animation
+// is running, as the animation interpolates the geometry points it was set up with.
+XYSeriesColumns XYChart::geometryColumns(int &offset) const
+{
+    offset = 0;
+    const XYSeriesColumns columns = m_series->d_func()->columns();
+    if (m_cullingMargin < 0 || m_series->useOpenGL()
+        || (m_animation && m_animation->state() != QAbstractAnimation::Stopped)) {
+        return columns;
+    }
+
+    const AbstractDomain::DomainType type = domain()->type();
+    if (type != AbstractDomain::XYDomain && type != AbstractDomain::LogXYDomain
+        && type != AbstractDomain::XLogYDomain && type != AbstractDomain::LogXLogYDomain) {
+        return columns;
+    }
+
+    int first;
+    int last;
+    if (!m_series->d_func()->coveringRange(domain()->minX(), domain()->maxX(), m_cullingMargin,
+                                           first, last)) {
+        return columns;
+    }
+    offset = first;
+    return columns.mid(first, last - first + 1);
+}
+
+// Returns a rectangle that contains the stroke a QPainterPathStroker with the given width,
+// miter joins, and square caps would create for path, without creating the stroke.
+QRectF XYChart::strokeBoundingRect(const QPainterPath &path, qreal width, qreal miterLimit)
+{
+    if (path.isEmpty())
+        return QRectF();
+    return strokeBoundingRect(path.controlPointRect(), width, miterLimit);
+}
+
+// Returns rect grown by the largest distance the stroke of a path within rect can extend
+// beyond the path.
+QRectF XYChart::strokeBoundingRect(const QRectF &rect, qreal width, qreal miterLimit)
+{
+    const qreal extent = width / 2 * qMax(miterLimit, qreal(M_SQRT2));
+    return rect.adjusted(-extent, -extent, extent, extent);
+}
+
+// Calculates the geometry points of the series, see geometryColumns().
+QVector<QPointF> XYChart::calculateGeometryPoints()
+{
+    const XYSeriesColumns columns = geometryColumns(m_newPointsOffset);
+    m_newPointsCulled = columns.count() != m_series->count();
+    return domain()->calculateColumnGeometryPoints(columns);
+}
+
+// Returns true if the change from the current geometry points to the ones calculated last can
+// be animated. Animations interpolate the points one to one, so culled geometry points can
+// only be animated from and to geometry points of the same range of the series.
+bool XYChart::isAnimatable(int oldCount, int newCount) const
+{
+    if (!m_pointsCulled && !m_newPointsCulled)
+        return true;
+    return m_pointsOffset == m_newPointsOffset && oldCount == newCount;
+}
+
+// Makes the range of the series covered by the geometry points calculated last the current one.
+void XYChart::applyPointsRange()
+{
+    m_pointsOffset = m_newPointsOffset;
+    m_pointsCulled = m_newPointsCulled;
+}
+
 void XYChart::setAnimation(XYAnimation *animation)
 {
     m_animation = animation;
@@ -91,10 +180,11 @@ QVector<bool> XYChart::offGridStatusVector()
     // During remove animation series may have different number of points,
     // so ensure we don't go over the index. No need to check for zero points, this
     // will not be called in such a situation.
-    const int seriesLastIndex = m_series->count() - 1;
+    const XYSeriesColumns columns = m_series->d_func()->columns();
+    const int seriesLastIndex = columns.count() - 1;
 
     for (int i = 0; i < m_points.size(); i++) {
-        const QPointF &seriesPoint = m_series->at(qMin(seriesLastIndex, i));
+        const QPointF seriesPoint = columns.at(qMin(seriesLastIndex, i));
         if (seriesPoint.x() < minX
             || seriesPoint.x() > maxX
             || seriesPoint.y() < minY
@@ -107,20 +197,44 @@ QVector<bool> XYChart::offGridStatusVector()
     return returnVector;
 }
 
+// Returns true if count points are few enough to be animated, see QChart::animationPointLimit.
+bool XYChart::isWithinAnimationPointLimit(int count) const
+{
+    const int limit = presenter()->animationPointLimit();
+    return limit < 0 || count <= limit;
+}
+
 void XYChart::updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index)
 {
 
-    if (m_animation) {
+    if (m_animation && !m_streaming && isWithinAnimationPointLimit(newPoints.count())
+        && isAnimatable(oldPoints.count(), newPoints.count())) {
         m_animation->setup(oldPoints, newPoints, index);
         m_points = newPoints;
-        setDirty(false);
+        applyPointsRange();
+        // Culled geometry points don't match the series points one to one.
+        setDirty(m_pointsCulled);
         presenter()->startAnimation(m_animation);
     } else {
+        if (m_animation && m_animation->state() != QAbstractAnimation::Stopped)
+            m_animation->stop();
         m_points = newPoints;
+        applyPointsRange();
+        // Geometry points only match the series points one to one if no point was rejected
+        // by the domain or culled.
+        setDirty(m_points.size() != m_series->count());
         updateGeometry();
     }
 }
 
+// Called when the points starting from the index first have been appended to the geometry
+// points. Items that can extend their geometry incrementally reimplement this.
+void XYChart::extendGeometry(int first)
+{
+    Q_UNUSED(first)
+    updateGeometry();
+}
+
 void XYChart::updateGlChart()
 {
     dataSet()->glXYSeriesDataManager()->setPoints(m_series, domain());
@@ -128,6 +242,15 @@ void XYChart::updateGlChart()
     updateGeometry();
 }
 
+// Updates the gl geometry of count points starting at index, which have been appended or
+// changed in place. Only the changed vertices are uploaded.
+void XYChart::updateGlChart(int index, int count)
+{
+    dataSet()->glXYSeriesDataManager()->updatePoints(m_series, domain(), index, count);
+    presenter()->updateGLWidget();
+    updateGeometry();
+}
+
 // Doesn't update gl geometry, but refreshes the chart
 void XYChart::refreshGlChart()
 {
@@ -142,15 +265,40 @@ void XYChart::handlePointAdded(int index)
     Q_ASSERT(index < m_series->count());
     Q_ASSERT(index >= 0);
 
+    // Points appended to the end while a previous change is still being animated are
+    // considered a data stream. Streamed points are not animated, and the geometry is only
+    // extended by the new point instead of being recalculated.
+    const bool appended = index == m_series->count() - 1;
+    if (appended && m_animation && m_animation->state() != QAbstractAnimation::Stopped)
+        m_streaming = true;
+    else if (!appended)
+        m_streaming = false;
+
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        if (appended)
+            updateGlChart(index, 1);
+        else
+            updateGlChart();
+    } else if (appended && (m_streaming || !m_animation) && !m_dirty
+               && m_points.size() == index
+               && (!m_animation || m_animation->state() == QAbstractAnimation::Stopped)) {
+        QPointF point = domain()->calculateGeometryPoint(m_series->d_func()->pointAt(index),
+                                                         m_validData);
+        if (!m_validData) {
+            m_points.clear();
+            setDirty(true);
+            updateGeometry();
+        } else {
+            m_points.append(point);
+            extendGeometry(index);
+        }
     } else {
         QVector<QPointF> points;
         if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+            points = calculateGeometryPoints();
         } else {
             points = m_points;
-            QPointF point = domain()->calculateGeometryPoint(m_series->pointsVector().at(index),
+            QPointF point = domain()->calculateGeometryPoint(m_series->d_func()->pointAt(index),
                                                              m_validData);
             if (!m_validData)
                 m_points.clear();
@@ -161,8 +309,44 @@ void XYChart::handlePointAdded(int index)
     }
 }
 
+void XYChart::handlePointsAdded(int index, int count)
+{
+    Q_ASSERT(index + count <= m_series->count());
+    Q_ASSERT(index >= 0);
+
+    // Bulk appends are treated like streamed points, see handlePointAdded().
+    const bool appended = index + count == m_series->count();
+    if (appended && m_animation && m_animation->state() != QAbstractAnimation::Stopped)
+        m_streaming = true;
+    else if (!appended)
+        m_streaming = false;
+
+    if (m_series->useOpenGL()) {
+        updateGlChart(index, count);
+    } else if (appended && (m_streaming || !m_animation) && !m_dirty
+               && m_points.size() == index
+               && (!m_animation || m_animation->state() == QAbstractAnimation::Stopped)) {
+        const QVector<QPointF> points =
+                domain()->calculateColumnGeometryPoints(
+                    m_series->d_func()->columns().mid(index, count));
+        if (points.size() != count) {
+            m_points.clear();
+            setDirty(true);
+            updateGeometry();
+        } else {
+            m_points += points;
+            extendGeometry(index);
+        }
+    } else {
+        QVector<QPointF> points = calculateGeometryPoints();
+        updateChart(m_points, points);
+    }
+}
+
 void XYChart::handlePointRemoved(int index)
 {
+    m_streaming = false;
+
     Q_ASSERT(index <= m_series->count());
     Q_ASSERT(index >= 0);
 
@@ -171,7 +355,7 @@ void XYChart::handlePointRemoved(int index)
     } else {
         QVector<QPointF> points;
         if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+            points = calculateGeometryPoints();
         } else {
             points = m_points;
             points.remove(index);
@@ -182,6 +366,8 @@ void XYChart::handlePointRemoved(int index)
 
 void XYChart::handlePointsRemoved(int index, int count)
 {
+    m_streaming = false;
+
     Q_ASSERT(index <= m_series->count());
     Q_ASSERT(index >= 0);
 
@@ -190,7 +376,7 @@ void XYChart::handlePointsRemoved(int index, int count)
     } else {
         QVector<QPointF> points;
         if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+            points = calculateGeometryPoints();
         } else {
             points = m_points;
             points.remove(index, count);
@@ -201,17 +387,19 @@ void XYChart::handlePointsRemoved(int index, int count)
 
 void XYChart::handlePointReplaced(int index)
 {
+    m_streaming = false;
+
     Q_ASSERT(index < m_series->count());
     Q_ASSERT(index >= 0);
 
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        updateGlChart(index, 1);
     } else {
         QVector<QPointF> points;
         if (m_dirty || m_points.isEmpty()) {
-            points = domain()->calculateGeometryPoints(m_series->pointsVector());
+            points = calculateGeometryPoints();
         } else {
-            QPointF point = domain()->calculateGeometryPoint(m_series->pointsVector().at(index),
+            QPointF point = domain()->calculateGeometryPoint(m_series->d_func()->pointAt(index),
                                                              m_validData);
             if (!m_validData)
                 m_points.clear();
@@ -225,29 +413,82 @@ void XYChart::handlePointReplaced(int index)
 
 void XYChart::handlePointsReplaced()
 {
+    m_streaming = false;
+
     if (m_series->useOpenGL()) {
         updateGlChart();
     } else {
         // All the points were replaced -> recalculate
-        QVector<QPointF> points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        QVector<QPointF> points = calculateGeometryPoints();
         updateChart(m_points, points, -1);
     }
 }
 
+// Called when the values of a range of points in external series data have changed.
+// Only the changed range is mapped again.
+void XYChart::handlePointsChanged(int index, int count)
+{
+    m_streaming = false;
+
+    Q_ASSERT(index >= 0);
+    Q_ASSERT(index + count <= m_series->count());
+
+    if (m_series->useOpenGL()) {
+        updateGlChart(index, count);
+    } else {
+        QVector<QPointF> points;
+        if (m_dirty || m_points.isEmpty()) {
+            points = calculateGeometryPoints();
+        } else {
+            const QVector<QPointF> changed = domain()->calculateColumnGeometryPoints(
+                        m_series->d_func()->columns().mid(index, count));
+            if (changed.size() != count) {
+                points = calculateGeometryPoints();
+            } else {
+                points = m_points;
+                for (int i = 0; i < count; i++)
+                    points[index + i] = changed.at(i);
+            }
+        }
+        updateChart(m_points, points);
+    }
+}
+
 void XYChart::handleDomainUpdated()
 {
     if (m_series->useOpenGL()) {
-        updateGlChart();
+        // Vertices of value axes don't depend on the domain, only the transformation changes.
+        updateGlChart(0, 0);
     } else {
-        if (isEmpty()) return;
-        QVector<QPointF> points = domain()->calculateGeometryPoints(m_series->pointsVector());
+        if (isEmpty()) {
+            // Geometry points no longer match the domain.
+            setDirty(true);
+            return;
+        }
+        // While the presenter batches domain updates, the geometry is calculated for all the
+        // series at once and applied with applyGeometryPoints().
+        if (presenter() && presenter()->deferGeometryUpdate(this))
+            return;
+        QVector<QPointF> points = calculateGeometryPoints();
         updateChart(m_points, points);
     }
 }
 
+// Applies geometry points calculated from the values returned by geometryColumns().
+void XYChart::applyGeometryPoints(QVector<QPointF> &points, int offset)
+{
+    if (isEmpty()) {
+        setDirty(true);
+        return;
+    }
+    m_newPointsOffset = offset;
+    m_newPointsCulled = offset != 0 || points.count() != m_series->count();
+    updateChart(m_points, points);
+}
+
 bool XYChart::isEmpty()
 {
-    return domain()->isEmpty() || m_series->points().isEmpty();
+    return domain()->isEmpty() || m_series->count() == 0;
 }
 
 #include "moc_xychart_p.cpp"
@@ -6,13 +6,19 @@ SOURCES += \
     $$PWD/qxymodelmapper.cpp \
     $$PWD/qvxymodelmapper.cpp \
     $$PWD/qhxymodelmapper.cpp  \
-    $$PWD/glxyseriesdata.cpp
+    $$PWD/glxyseriesdata.cpp \
+    $$PWD/xyseriescolumns.cpp \
+    $$PWD/xyrangeindex.cpp \
+    $$PWD/xypointlabelcache.cpp
 
 PRIVATE_HEADERS += \
     $$PWD/xychart_p.h \
     $$PWD/qxyseries_p.h \
     $$PWD/qxymodelmapper_p.h \
-    $$PWD/glxyseriesdata_p.h
+    $$PWD/glxyseriesdata_p.h \
+    $$PWD/xyseriescolumns_p.h \
+    $$PWD/xyrangeindex_p.h \
+    $$PWD/xypointlabelcache_p.h
 
 PUBLIC_HEADERS += \
     $$PWD/qxyseries.h \
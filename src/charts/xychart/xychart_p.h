@@ -42,6 +42,7 @@
 #include <QtCharts/QChartGlobal>
 #include <private/chartitem_p.h>
 #include <private/xyanimation_p.h>
+#include <private/xyseriescolumns_p.h>
 #include <QtCharts/QValueAxis>
 #include <QtCharts/private/qchartglobal_p.h>
 #include <QtGui/QPen>
@@ -59,6 +60,7 @@ public:
     ~XYChart() {}
 
     void setGeometryPoints(const QVector<QPointF> &points);
+    void swapGeometryPoints(QVector<QPointF> &points) { m_points.swap(points); }
     QVector<QPointF> geometryPoints() const { return m_points; }
 
     void setAnimation(XYAnimation *animation);
@@ -68,15 +70,23 @@ public:
     bool isDirty() const { return m_dirty; }
     void setDirty(bool dirty);
 
+    bool isStreaming() const { return m_streaming; }
+
+    XYSeriesColumns geometryColumns(int &offset) const;
+    void applyGeometryPoints(QVector<QPointF> &points, int offset = 0);
+    int geometryPointsOffset() const { return m_pointsOffset; }
+
     void getSeriesRanges(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY);
     QVector<bool> offGridStatusVector();
 
 public Q_SLOTS:
     void handlePointAdded(int index);
+    void handlePointsAdded(int index, int count);
     void handlePointRemoved(int index);
     void handlePointsRemoved(int index, int count);
     void handlePointReplaced(int index);
     void handlePointsReplaced();
+    void handlePointsChanged(int index, int count);
     void handleDomainUpdated();
 
 Q_SIGNALS:
@@ -88,8 +98,17 @@ Q_SIGNALS:
 
 protected:
     virtual void updateChart(QVector<QPointF> &oldPoints, QVector<QPointF> &newPoints, int index = -1);
+    virtual void extendGeometry(int first);
     virtual void updateGlChart();
+    void updateGlChart(int index, int count);
     virtual void refreshGlChart();
+    void setCullingMargin(int margin);
+    bool isWithinAnimationPointLimit(int count) const;
+    static QRectF strokeBoundingRect(const QPainterPath &path, qreal width, qreal miterLimit);
+    static QRectF strokeBoundingRect(const QRectF &rect, qreal width, qreal miterLimit);
+    QVector<QPointF> calculateGeometryPoints();
+    bool isAnimatable(int oldCount, int newCount) const;
+    void applyPointsRange();
 
 private:
     inline bool isEmpty();
@@ -99,6 +118,15 @@ protected:
     QVector<QPointF> m_points;
     XYAnimation *m_animation;
     bool m_dirty;
+    bool m_streaming;
+    // Index of the series point of the first geometry point, and whether points of the series
+    // outside the view are left out of the geometry points.
+    int m_pointsOffset;
+    bool m_pointsCulled;
+    // The same for the geometry points calculated last, until updateChart() applies them.
+    int m_newPointsOffset;
+    bool m_newPointsCulled;
+    int m_cullingMargin;
 
     friend class AreaChartItem;
 };
@@ -0,0 +1,151 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/xypointlabelcache_p.h>
+#include <private/chartpresenter_p.h>
+#include <QtCore/QtMath>
+#include <QtGui/QFontMetrics>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+XYPointLabelCache::XYPointLabelCache()
+    : m_presenter(0),
+      m_localizeNumbers(false),
+      m_generation(0),
+      m_used(0)
+{
+}
+
+void XYPointLabelCache::invalidate()
+{
+    m_labels.clear();
+}
+
+// The labels are formatted with the numbers of presenter, which has to outlive the paint.
+void XYPointLabelCache::setFormat(const QString &format, const QFont &font,
+                                  ChartPresenter *presenter)
+{
+    m_presenter = presenter;
+    if (format == m_format && font == m_font
+        && presenter->localizeNumbers() == m_localizeNumbers
+        && presenter->locale() == m_locale) {
+        return;
+    }
+    m_format = format;
+    m_font = font;
+    m_localizeNumbers = presenter->localizeNumbers();
+    m_locale = presenter->locale();
+    invalidate();
+}
+
+void XYPointLabelCache::beginPaint()
+{
+    m_generation++;
+    m_used = 0;
+}
+
+// Returns the label of the point at index, and its width measured with metrics in width.
+// The metrics have to be those of the font given to setFormat().
+const QString &XYPointLabelCache::label(int index, const QPointF &point,
+                                        const QFontMetrics &metrics, int *width)
+{
+    static const QString xPointTag(QLatin1String("@xPoint"));
+    static const QString yPointTag(QLatin1String("@yPoint"));
+
+    Label &label = m_labels[index];
+    // QPointF compares fuzzily, which would keep the label of a point that moved only slightly.
+    if (!label.valid || label.point.x() != point.x() || label.point.y() != point.y()) {
+        label.valid = true;
+        label.point = point;
+        label.text = m_format;
+        label.text.replace(xPointTag, m_presenter->numberToString(point.x()));
+        label.text.replace(yPointTag, m_presenter->numberToString(point.y()));
+        label.width = metrics.width(label.text);
+    }
+    if (label.generation != m_generation) {
+        label.generation = m_generation;
+        m_used++;
+    }
+    *width = label.width;
+    return label.text;
+}
+
+// Drops the labels that were not needed by the paint if most of the cached labels are unused,
+// for example after zooming in.
+void XYPointLabelCache::endPaint()
+{
+    if (m_labels.size() <= 2 * m_used + 256)
+        return;
+    QHash<int, Label>::iterator i = m_labels.begin();
+    while (i != m_labels.end()) {
+        if (i.value().generation != m_generation)
+            i = m_labels.erase(i);
+        else
+            ++i;
+    }
+}
+
+XYLabelCollisionGrid::XYLabelCollisionGrid(qreal cellWidth, qreal cellHeight)
+    : m_cellWidth(qMax(cellWidth, qreal(1.0))),
+      m_cellHeight(qMax(cellHeight, qreal(1.0)))
+{
+}
+
+// Adds rect to the grid and returns true, unless rect overlaps a rectangle added before.
+bool XYLabelCollisionGrid::insert(const QRectF &rect)
+{
+    const int left = qFloor(rect.left() / m_cellWidth);
+    const int right = qFloor(rect.right() / m_cellWidth);
+    const int top = qFloor(rect.top() / m_cellHeight);
+    const int bottom = qFloor(rect.bottom() / m_cellHeight);
+
+    for (int y = top; y <= bottom; y++) {
+        for (int x = left; x <= right; x++) {
+            const quint64 key = (quint64(quint32(x)) << 32) | quint32(y);
+            QHash<quint64, QVector<int> >::const_iterator cell = m_cells.constFind(key);
+            if (cell == m_cells.constEnd())
+                continue;
+            for (int i = 0; i < cell->size(); i++) {
+                if (m_rects.at(cell->at(i)).intersects(rect))
+                    return false;
+            }
+        }
+    }
+
+    const int index = m_rects.size();
+    m_rects.append(rect);
+    for (int y = top; y <= bottom; y++) {
+        for (int x = left; x <= right; x++)
+            m_cells[(quint64(quint32(x)) << 32) | quint32(y)].append(index);
+    }
+    return true;
+}
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,115 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYPOINTLABELCACHE_P_H
+#define XYPOINTLABELCACHE_P_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QHash>
+#include <QtCore/QLocale>
+#include <QtCore/QPointF>
+#include <QtCore/QRectF>
+#include <QtCore/QVector>
+#include <QtGui/QFont>
+
+QT_BEGIN_NAMESPACE
+class QFontMetrics;
+QT_END_NAMESPACE
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class ChartPresenter;
+
+// Caches the formatted point labels of a series together with their widths, so that repainting
+// the labels of unchanged points formats and measures no strings. The labels are keyed by the
+// point index and validated against the point value, and all of them are dropped when the label
+// format, the font, or the number localization changes.
+class QT_CHARTS_PRIVATE_EXPORT XYPointLabelCache
+{
+public:
+    XYPointLabelCache();
+
+    void invalidate();
+    void setFormat(const QString &format, const QFont &font, ChartPresenter *presenter);
+
+    void beginPaint();
+    const QString &label(int index, const QPointF &point, const QFontMetrics &metrics,
+                         int *width);
+    void endPaint();
+
+private:
+    struct Label
+    {
+        QPointF point;
+        QString text;
+        int width;
+        uint generation;
+        bool valid;
+    };
+
+    QHash<int, Label> m_labels;
+    QString m_format;
+    QFont m_font;
+    ChartPresenter *m_presenter; // Not owned.
+    bool m_localizeNumbers;
+    QLocale m_locale;
+    uint m_generation;
+    int m_used;
+};
+
+// Keeps track of the label rectangles drawn so far in a uniform grid, so that a label that
+// would overlap one of them can be dropped without comparing it to all of them.
+class QT_CHARTS_PRIVATE_EXPORT XYLabelCollisionGrid
+{
+public:
+    XYLabelCollisionGrid(qreal cellWidth, qreal cellHeight);
+
+    bool insert(const QRectF &rect);
+
+private:
+    qreal m_cellWidth;
+    qreal m_cellHeight;
+    QVector<QRectF> m_rects;
+    QHash<quint64, QVector<int> > m_cells;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // XYPOINTLABELCACHE_P_H
@@ -0,0 +1,336 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/xyrangeindex_p.h>
+#include <private/xyseriescolumns_p.h>
+#include <limits>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+XYRangeIndex::XYRangeIndex()
+    : m_valid(false),
+      m_sortedX(false),
+      m_count(0),
+      m_leafCount(0)
+{
+}
+
+// Drops the index, it is rebuilt the next time it is queried.
+void XYRangeIndex::invalidate()
+{
+    m_valid = false;
+    m_tree.clear();
+}
+
+// Adds the points of columns starting at first to the index. If the index does not cover
+// exactly the points before first, it is dropped instead.
+void XYRangeIndex::pointsAppended(const XYSeriesColumns &columns, int first)
+{
+    if (!m_valid)
+        return;
+    const int count = columns.count();
+    if (first != m_count || count < first) {
+        invalidate();
+        return;
+    }
+    if (count == first)
+        return;
+    if ((count - 1) / blockSize >= m_leafCount) {
+        // The tree is full, rebuilding it with twice the leaves keeps appending
+        // amortized constant time.
+        build(columns);
+        return;
+    }
+
+    const XYSeriesColumns::Column &x = columns.x();
+    const XYSeriesColumns::Column &y = columns.y();
+    qreal previousX = first > 0 ? x.at(first - 1) : 0;
+    for (int i = first; i < count; ++i) {
+        const qreal valueX = x.at(i);
+        const qreal valueY = y.at(i);
+        if (i > 0 && valueX < previousX)
+            m_sortedX = false;
+        previousX = valueX;
+        Summary &leaf = m_tree[m_leafCount + i / blockSize];
+        const Summary point = { valueX, valueX, valueY, valueY };
+        merge(leaf, point);
+    }
+    for (int block = first / blockSize; block <= (count - 1) / blockSize; ++block)
+        updatePath(block);
+    m_count = count;
+}
+
+// Updates the summaries of the blocks that contain the count changed points starting at index.
+void XYRangeIndex::pointsChanged(const XYSeriesColumns &columns, int index, int count)
+{
+    if (!m_valid)
+        return;
+    if (columns.count() != m_count) {
+        invalidate();
+        return;
+    }
+    index = qBound(0, index, m_count);
+    count = qMin(count, m_count - index);
+    if (count <= 0)
+        return;
+
+    for (int block = index / blockSize; block <= (index + count - 1) / blockSize; ++block) {
+        scanBlock(columns, block);
+        updatePath(block);
+    }
+
+    // Only the order around the changed points needs to be checked. An index that is not
+    // sorted any more is not marked sorted again until it is rebuilt.
+    if (m_sortedX) {
+        const XYSeriesColumns::Column &x = columns.x();
+        const int last = qMin(index + count, m_count - 1);
+        for (int i = qMax(index, 1); i <= last; ++i) {
+            if (x.at(i) < x.at(i - 1)) {
+                m_sortedX = false;
+                break;
+            }
+        }
+    }
+}
+
+// Finds the value ranges of all points. Returns false if there are no points.
+bool XYRangeIndex::bounds(const XYSeriesColumns &columns, qreal &minX, qreal &maxX,
+                          qreal &minY, qreal &maxY)
+{
+    if (!m_valid || m_count != columns.count())
+        build(columns);
+    if (m_count == 0)
+        return false;
+    const Summary &root = m_tree.at(1);
+    minX = root.minX;
+    maxX = root.maxX;
+    minY = root.minY;
+    maxY = root.maxY;
+    return true;
+}
+
+// Finds the range of the y-values of the points whose x-value is between fromX and toX.
+// Returns false if there are no such points.
+bool XYRangeIndex::yRange(const XYSeriesColumns &columns, qreal fromX, qreal toX,
+                          qreal &minY, qreal &maxY)
+{
+    if (!m_valid || m_count != columns.count())
+        build(columns);
+    if (m_count == 0 || !(fromX <= toX))
+        return false;
+
+    Summary summary = emptySummary();
+    if (m_sortedX) {
+        // Binary search the index range of the window, then combine the partial blocks at
+        // its ends with the tree summary of the full blocks in between.
+        int first;
+        int last;
+        if (!indexRange(columns, fromX, toX, first, last))
+            return false;
+
+        const int firstBlock = first / blockSize;
+        const int lastBlock = last / blockSize;
+        if (firstBlock == lastBlock) {
+            scanY(columns, first, last, fromX, toX, summary);
+        } else {
+            scanY(columns, first, (firstBlock + 1) * blockSize - 1, fromX, toX, summary);
+            scanY(columns, lastBlock * blockSize, last, fromX, toX, summary);
+            if (firstBlock + 1 < lastBlock)
+                merge(summary, query(firstBlock + 1, lastBlock - 1));
+        }
+    } else {
+        // Blocks completely inside the window are taken from their summaries, and only
+        // the blocks crossing its edges are scanned.
+        const int blockCount = (m_count + blockSize - 1) / blockSize;
+        for (int block = 0; block < blockCount; ++block) {
+            const Summary &leaf = m_tree.at(m_leafCount + block);
+            if (leaf.maxX < fromX || leaf.minX > toX)
+                continue;
+            if (leaf.minX >= fromX && leaf.maxX <= toX) {
+                merge(summary, leaf);
+            } else {
+                scanY(columns, block * blockSize, qMin((block + 1) * blockSize, m_count) - 1,
+                      fromX, toX, summary);
+            }
+        }
+    }
+
+    if (summary.minY > summary.maxY)
+        return false;
+    minY = summary.minY;
+    maxY = summary.maxY;
+    return true;
+}
+
+// Returns true if the x-values of the points are in ascending order.
+bool XYRangeIndex::isSortedX(const XYSeriesColumns &columns)
+{
+    if (!m_valid || m_count != columns.count())
+        build(columns);
+    return m_sortedX;
+}
+
+// Finds the indexes of the first and the last point whose x-value is between fromX and toX
+// by binary search. Returns false if the x-values are not sorted, or if there are no such
+// points.
+bool XYRangeIndex::indexRange(const XYSeriesColumns &columns, qreal fromX, qreal toX,
+                              int &first, int &last)
+{
+    if (!isSortedX(columns) || !(fromX <= toX))
+        return false;
+    first = lowerBound(columns, fromX);
+    last = upperBound(columns, toX) - 1;
+    return first <= last;
+}
+
+// Returns the index of the first point whose x-value is not less than x.
+int XYRangeIndex::lowerBound(const XYSeriesColumns &columns, qreal x)
+{
+    const XYSeriesColumns::Column &column = columns.x();
+    int low = 0;
+    int high = columns.count();
+    while (low < high) {
+        const int middle = low + (high - low) / 2;
+        if (column.at(middle) < x)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+// Returns the index of the first point whose x-value is greater than x.
+int XYRangeIndex::upperBound(const XYSeriesColumns &columns, qreal x)
+{
+    const XYSeriesColumns::Column &column = columns.x();
+    int low = 0;
+    int high = columns.count();
+    while (low < high) {
+        const int middle = low + (high - low) / 2;
+        if (column.at(middle) <= x)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+void XYRangeIndex::build(const XYSeriesColumns &columns)
+{
+    m_count = columns.count();
+    const int blockCount = (m_count + blockSize - 1) / blockSize;
+    m_leafCount = 1;
+    while (m_leafCount < blockCount)
+        m_leafCount *= 2;
+    m_tree.fill(emptySummary(), 2 * m_leafCount);
+
+    for (int block = 0; block < blockCount; ++block)
+        scanBlock(columns, block);
+    for (int node = m_leafCount - 1; node > 0; --node) {
+        m_tree[node] = m_tree.at(2 * node);
+        merge(m_tree[node], m_tree.at(2 * node + 1));
+    }
+
+    m_sortedX = true;
+    const XYSeriesColumns::Column &x = columns.x();
+    for (int i = 1; i < m_count; ++i) {
+        if (x.at(i) < x.at(i - 1)) {
+            m_sortedX = false;
+            break;
+        }
+    }
+    m_valid = true;
+}
+
+void XYRangeIndex::scanBlock(const XYSeriesColumns &columns, int block)
+{
+    const int first = block * blockSize;
+    Summary &leaf = m_tree[m_leafCount + block];
+    leaf = emptySummary();
+    columns.mid(first, qMin(blockSize, m_count - first))
+            .bounds(leaf.minX, leaf.maxX, leaf.minY, leaf.maxY);
+}
+
+void XYRangeIndex::updatePath(int block)
+{
+    for (int node = (m_leafCount + block) / 2; node > 0; node /= 2) {
+        m_tree[node] = m_tree.at(2 * node);
+        merge(m_tree[node], m_tree.at(2 * node + 1));
+    }
+}
+
+// Combines the summaries of the blocks from firstBlock to lastBlock.
+XYRangeIndex::Summary XYRangeIndex::query(int firstBlock, int lastBlock) const
+{
+    Summary summary = emptySummary();
+    int left = m_leafCount + firstBlock;
+    int right = m_leafCount + lastBlock + 1;
+    while (left < right) {
+        if (left & 1)
+            merge(summary, m_tree.at(left++));
+        if (right & 1)
+            merge(summary, m_tree.at(--right));
+        left /= 2;
+        right /= 2;
+    }
+    return summary;
+}
+
+void XYRangeIndex::scanY(const XYSeriesColumns &columns, int first, int last,
+                         qreal fromX, qreal toX, Summary &summary) const
+{
+    const XYSeriesColumns::Column &x = columns.x();
+    const XYSeriesColumns::Column &y = columns.y();
+    for (int i = first; i <= last; ++i) {
+        const qreal valueX = x.at(i);
+        if (valueX < fromX || valueX > toX)
+            continue;
+        const qreal valueY = y.at(i);
+        summary.minY = qMin(summary.minY, valueY);
+        summary.maxY = qMax(summary.maxY, valueY);
+    }
+}
+
+XYRangeIndex::Summary XYRangeIndex::emptySummary()
+{
+    const qreal infinity = std::numeric_limits<qreal>::infinity();
+    const Summary summary = { infinity, -infinity, infinity, -infinity };
+    return summary;
+}
+
+void XYRangeIndex::merge(Summary &summary, const Summary &other)
+{
+    summary.minX = qMin(summary.minX, other.minX);
+    summary.maxX = qMax(summary.maxX, other.maxX);
+    summary.minY = qMin(summary.minY, other.minY);
+    summary.maxY = qMax(summary.maxY, other.maxY);
+}
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,107 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYRANGEINDEX_P_H
+#define XYRANGEINDEX_P_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QVector>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+class XYSeriesColumns;
+
+// Maintains the value ranges of an XY series. The points are summarized in blocks, and the
+// block summaries are kept in a segment tree, so that the ranges of the whole series are
+// available in constant time and the y-range of an x-window in logarithmic time if the
+// x-values are sorted. The index is built on first use, kept up to date on appends and
+// in-place changes, and rebuilt lazily after other changes.
+class QT_CHARTS_PRIVATE_EXPORT XYRangeIndex
+{
+public:
+    XYRangeIndex();
+
+    void invalidate();
+    void pointsAppended(const XYSeriesColumns &columns, int first);
+    void pointsChanged(const XYSeriesColumns &columns, int index, int count);
+
+    bool bounds(const XYSeriesColumns &columns, qreal &minX, qreal &maxX,
+                qreal &minY, qreal &maxY);
+    bool yRange(const XYSeriesColumns &columns, qreal fromX, qreal toX,
+                qreal &minY, qreal &maxY);
+
+    bool isSortedX(const XYSeriesColumns &columns);
+    bool indexRange(const XYSeriesColumns &columns, qreal fromX, qreal toX,
+                    int &first, int &last);
+
+    // The binary searches require sorted x-values.
+    static int lowerBound(const XYSeriesColumns &columns, qreal x);
+    static int upperBound(const XYSeriesColumns &columns, qreal x);
+
+    static const int blockSize = 256;
+
+private:
+    struct Summary
+    {
+        qreal minX;
+        qreal maxX;
+        qreal minY;
+        qreal maxY;
+    };
+
+    void build(const XYSeriesColumns &columns);
+    void scanBlock(const XYSeriesColumns &columns, int block);
+    void updatePath(int block);
+    Summary query(int firstBlock, int lastBlock) const;
+    void scanY(const XYSeriesColumns &columns, int first, int last, qreal fromX, qreal toX,
+               Summary &summary) const;
+    static Summary emptySummary();
+    static void merge(Summary &summary, const Summary &other);
+
+    bool m_valid;
+    bool m_sortedX;
+    int m_count;
+    int m_leafCount;
+    QVector<Summary> m_tree;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // XYRANGEINDEX_P_H
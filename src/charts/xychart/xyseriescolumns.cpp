@@ -0,0 +1,244 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <private/xyseriescolumns_p.h>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+static XYSeriesColumns::Column makeColumn(const void *data, int stride,
+                                          XYSeriesColumns::ValueType type)
+{
+    XYSeriesColumns::Column column;
+    column.data = static_cast<const char *>(data);
+    column.stride = stride;
+    column.type = type;
+    return column;
+}
+
+// Reads a column with a known value type. Contiguous columns are read through a plain
+// array, which the compiler can vectorize.
+template <typename T>
+class ColumnReader
+{
+public:
+    explicit ColumnReader(const XYSeriesColumns::Column &column)
+        : m_data(column.data),
+          m_stride(column.stride),
+          m_contiguous(column.stride == int(sizeof(T)))
+    {
+    }
+
+    inline T operator[](int index) const
+    {
+        if (m_contiguous)
+            return reinterpret_cast<const T *>(m_data)[index];
+        return *reinterpret_cast<const T *>(m_data + qptrdiff(index) * m_stride);
+    }
+
+private:
+    const char *m_data;
+    int m_stride;
+    bool m_contiguous;
+};
+
+template <typename X, typename Y>
+static void copyColumnPoints(const XYSeriesColumns &columns, QPointF *target)
+{
+    const ColumnReader<X> x(columns.x());
+    const ColumnReader<Y> y(columns.y());
+    const int count = columns.count();
+    for (int i = 0; i < count; ++i)
+        target[i] = QPointF(qreal(x[i]), qreal(y[i]));
+}
+
+template <typename X, typename Y>
+static void copyColumnFloats(const XYSeriesColumns &columns, float *target)
+{
+    const ColumnReader<X> x(columns.x());
+    const ColumnReader<Y> y(columns.y());
+    const int count = columns.count();
+    for (int i = 0; i < count; ++i) {
+        target[2 * i] = float(x[i]);
+        target[2 * i + 1] = float(y[i]);
+    }
+}
+
+template <typename T>
+static void columnBounds(const XYSeriesColumns::Column &column, int count, qreal &min, qreal &max)
+{
+    const ColumnReader<T> values(column);
+    T minValue = values[0];
+    T maxValue = minValue;
+    for (int i = 1; i < count; ++i) {
+        const T value = values[i];
+        minValue = qMin(minValue, value);
+        maxValue = qMax(maxValue, value);
+    }
+    min = qreal(minValue);
+    max = qreal(maxValue);
+}
+
+XYSeriesColumns::XYSeriesColumns()
+    : m_x(makeColumn(0, 0, Double)),
+      m_y(makeColumn(0, 0, Double)),
+      m_count(0),
+      m_pointArray(false),
+      m_external(false)
+{
+}
+
+XYSeriesColumns::XYSeriesColumns(const QVector<QPointF> &points)
+    : m_count(points.count()),
+      m_pointArray(true),
+      m_external(false),
+      m_points(points)
+{
+    const qreal *data = reinterpret_cast<const qreal *>(m_points.constData());
+    const ValueType type = sizeof(qreal) == sizeof(double) ? Double : Float;
+    m_x = makeColumn(data, int(sizeof(QPointF)), type);
+    m_y = makeColumn(data + 1, int(sizeof(QPointF)), type);
+}
+
+// If the vectors differ in size, the extra values of the longer one are ignored.
+XYSeriesColumns::XYSeriesColumns(const QVector<double> &x, const QVector<double> &y)
+    : m_count(qMin(x.count(), y.count())),
+      m_pointArray(false),
+      m_external(false),
+      m_doubleX(x),
+      m_doubleY(y)
+{
+    m_x = makeColumn(m_doubleX.constData(), int(sizeof(double)), Double);
+    m_y = makeColumn(m_doubleY.constData(), int(sizeof(double)), Double);
+}
+
+XYSeriesColumns::XYSeriesColumns(const QVector<float> &x, const QVector<float> &y)
+    : m_count(qMin(x.count(), y.count())),
+      m_pointArray(false),
+      m_external(false),
+      m_floatX(x),
+      m_floatY(y)
+{
+    m_x = makeColumn(m_floatX.constData(), int(sizeof(float)), Float);
+    m_y = makeColumn(m_floatY.constData(), int(sizeof(float)), Float);
+}
+
+// Creates a view of memory that is not owned by the view. The strides are given in bytes.
+XYSeriesColumns XYSeriesColumns::fromRawData(const void *x, int xStride, ValueType xType,
+                                             const void *y, int yStride, ValueType yType,
+                                             int count)
+{
+    XYSeriesColumns columns;
+    columns.m_x = makeColumn(x, xStride, xType);
+    columns.m_y = makeColumn(y, yStride, yType);
+    columns.m_count = qMax(count, 0);
+    columns.m_external = true;
+    return columns;
+}
+
+// Returns true if both views read the same memory in the same way. The counts may differ.
+bool XYSeriesColumns::sharesColumns(const XYSeriesColumns &other) const
+{
+    return m_x.data == other.m_x.data && m_x.stride == other.m_x.stride
+            && m_x.type == other.m_x.type && m_y.data == other.m_y.data
+            && m_y.stride == other.m_y.stride && m_y.type == other.m_y.type;
+}
+
+// Returns a view of count values starting at index. The view keeps the data shared.
+XYSeriesColumns XYSeriesColumns::mid(int index, int count) const
+{
+    Q_ASSERT(index >= 0 && count >= 0 && index + count <= m_count);
+    XYSeriesColumns columns(*this);
+    columns.m_x.data += qptrdiff(index) * m_x.stride;
+    columns.m_y.data += qptrdiff(index) * m_y.stride;
+    columns.m_count = count;
+    // The points no longer match the columns, they are only kept to keep the data alive.
+    columns.m_pointArray = false;
+    return columns;
+}
+
+QVector<QPointF> XYSeriesColumns::toPoints() const
+{
+    if (m_pointArray)
+        return m_points;
+    QVector<QPointF> points(m_count);
+    copyPoints(points.data());
+    return points;
+}
+
+// Copies the values into an array of count() points.
+void XYSeriesColumns::copyPoints(QPointF *target) const
+{
+    if (m_x.type == Double) {
+        if (m_y.type == Double)
+            copyColumnPoints<double, double>(*this, target);
+        else
+            copyColumnPoints<double, float>(*this, target);
+    } else {
+        if (m_y.type == Double)
+            copyColumnPoints<float, double>(*this, target);
+        else
+            copyColumnPoints<float, float>(*this, target);
+    }
+}
+
+// Copies the values into an array of count() interleaved x and y floats, as used by the
+// OpenGL vertex buffers.
+void XYSeriesColumns::copyFloats(float *target) const
+{
+    if (m_x.type == Double) {
+        if (m_y.type == Double)
+            copyColumnFloats<double, double>(*this, target);
+        else
+            copyColumnFloats<double, float>(*this, target);
+    } else {
+        if (m_y.type == Double)
+            copyColumnFloats<float, double>(*this, target);
+        else
+            copyColumnFloats<float, float>(*this, target);
+    }
+}
+
+// Finds the value ranges of both columns. Returns false if the view is empty.
+bool XYSeriesColumns::bounds(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY) const
+{
+    if (m_count == 0)
+        return false;
+    if (m_x.type == Double)
+        columnBounds<double>(m_x, m_count, minX, maxX);
+    else
+        columnBounds<float>(m_x, m_count, minX, maxX);
+    if (m_y.type == Double)
+        columnBounds<double>(m_y, m_count, minY, maxY);
+    else
+        columnBounds<float>(m_y, m_count, minY, maxY);
+    return true;
+}
+
+QT_CHARTS_END_NAMESPACE
@@ -0,0 +1,120 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt Chart API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+
+#ifndef XYSERIESCOLUMNS_P_H
+#define XYSERIESCOLUMNS_P_H
+
+#include <QtCharts/QChartGlobal>
+#include <QtCharts/private/qchartglobal_p.h>
+#include <QtCore/QPointF>
+#include <QtCore/QVector>
+
+QT_CHARTS_BEGIN_NAMESPACE
+
+// Read-only view of the values of an XY series as two columns. Each column is a strided array
+// of doubles or floats, so the view can refer to separate x and y arrays as well as to the
+// coordinates of a QPointF array. The vectors the columns are created from are shared with
+// the view, so the data stays valid as long as the view exists. External columns refer to
+// memory owned by the application instead.
+class QT_CHARTS_PRIVATE_EXPORT XYSeriesColumns
+{
+public:
+    enum ValueType {
+        Double,
+        Float
+    };
+
+    struct Column
+    {
+        const char *data;
+        int stride;
+        ValueType type;
+
+        inline qreal at(int index) const
+        {
+            const char *value = data + qptrdiff(index) * stride;
+            if (type == Double)
+                return qreal(*reinterpret_cast<const double *>(value));
+            return qreal(*reinterpret_cast<const float *>(value));
+        }
+    };
+
+    XYSeriesColumns();
+    explicit XYSeriesColumns(const QVector<QPointF> &points);
+    XYSeriesColumns(const QVector<double> &x, const QVector<double> &y);
+    XYSeriesColumns(const QVector<float> &x, const QVector<float> &y);
+
+    static XYSeriesColumns fromRawData(const void *x, int xStride, ValueType xType,
+                                       const void *y, int yStride, ValueType yType, int count);
+
+    bool isNull() const { return !m_x.data; }
+    int count() const { return m_count; }
+    const Column &x() const { return m_x; }
+    const Column &y() const { return m_y; }
+
+    // True if the view refers to a QPointF array, which is then returned by points().
+    bool isPointArray() const { return m_pointArray; }
+    const QVector<QPointF> &points() const { return m_points; }
+
+    bool isExternal() const { return m_external; }
+    bool sharesColumns(const XYSeriesColumns &other) const;
+    XYSeriesColumns mid(int index, int count) const;
+
+    QPointF at(int index) const { return QPointF(m_x.at(index), m_y.at(index)); }
+    QVector<QPointF> toPoints() const;
+    void copyPoints(QPointF *target) const;
+    void copyFloats(float *target) const;
+    bool bounds(qreal &minX, qreal &maxX, qreal &minY, qreal &maxY) const;
+
+private:
+    Column m_x;
+    Column m_y;
+    int m_count;
+    bool m_pointArray;
+    bool m_external;
+    QVector<QPointF> m_points;
+    QVector<double> m_doubleX;
+    QVector<double> m_doubleY;
+    QVector<float> m_floatX;
+    QVector<float> m_floatY;
+};
+
+QT_CHARTS_END_NAMESPACE
+
+#endif // XYSERIESCOLUMNS_P_H
@@ -42,6 +42,7 @@ DeclarativeLineSeries::DeclarativeLineSeries(QObject *parent) :
     connect(m_axes, SIGNAL(axisXChanged(QAbstractAxis*)), this, SIGNAL(axisAngularChanged(QAbstractAxis*)));
     connect(m_axes, SIGNAL(axisYChanged(QAbstractAxis*)), this, SIGNAL(axisRadialChanged(QAbstractAxis*)));
     connect(this, SIGNAL(pointAdded(int)), this, SLOT(handleCountChanged(int)));
+    connect(this, SIGNAL(pointsAdded(int, int)), this, SLOT(handleCountChanged(int)));
     connect(this, SIGNAL(pointRemoved(int)), this, SLOT(handleCountChanged(int)));
     connect(this, SIGNAL(pointsRemoved(int, int)), this, SLOT(handleCountChanged(int)));
 }
@@ -43,6 +43,22 @@
 
 QT_CHARTS_BEGIN_NAMESPACE
 
+// Copies the series data from the GUI thread. Vertices that changed since the previous copy
+// but have not been uploaded yet stay dirty.
+static void copySeriesData(GLXYSeriesData *data, const GLXYSeriesData *newData)
+{
+    const bool dirty = data->dirty;
+    const int dirtyIndex = data->dirtyIndex;
+    const int dirtyCount = data->dirtyCount;
+    *data = *newData;
+    if (dirty) {
+        if (dirtyCount < 0)
+            data->setAllDirty();
+        else
+            data->addDirtyRange(dirtyIndex, dirtyCount);
+    }
+}
+
 // This node draws the xy series data on a transparent background using OpenGL.
 // It is used as a child node of the chart node.
 DeclarativeOpenGLRenderNode::DeclarativeOpenGLRenderNode(QQuickWindow *window) :
@@ -230,9 +246,12 @@ void DeclarativeOpenGLRenderNode::setSeriesData(bool mapDirty, const GLXYDataMap
             i.next();
             GLXYSeriesData *data = oldMap.take(i.key());
             const GLXYSeriesData *newData = i.value();
-            if (!data || newData->dirty) {
+            if (!data) {
                 data = new GLXYSeriesData;
                 *data = *newData;
+                data->setAllDirty();
+            } else if (newData->dirty) {
+                copySeriesData(data, newData);
             }
             m_xyDataMap.insert(i.key(), data);
         }
@@ -254,7 +273,7 @@ void DeclarativeOpenGLRenderNode::setSeriesData(bool mapDirty, const GLXYDataMap
                 dirty = true;
                 GLXYSeriesData *data = m_xyDataMap.value(i.key());
                 if (data)
-                    *data = *newData;
+                    copySeriesData(data, newData);
             }
         }
     }
@@ -329,16 +348,16 @@ void DeclarativeOpenGLRenderNode::renderGL(bool selection)
             m_program->setUniformValue(m_deltaUniformLoc, data->delta);
             m_program->setUniformValue(m_matrixUniformLoc, data->matrix);
 
+            bool newBuffer = false;
             if (!vbo) {
                 vbo = new QOpenGLBuffer;
                 m_seriesBufferMap.insert(i.key(), vbo);
                 vbo->create();
+                newBuffer = true;
             }
             vbo->bind();
-            if (data->dirty) {
-                vbo->allocate(data->array.constData(), data->array.count() * sizeof(GLfloat));
-                data->dirty = false;
-            }
+            if (newBuffer || data->dirty)
+                data->upload(vbo, newBuffer);
 
             glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
             if (data->type == QAbstractSeries::SeriesTypeLine) {
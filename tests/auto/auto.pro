@@ -22,12 +22,17 @@ SUBDIRS += \
            qbarcategoryaxis \
            domain \
            chartdataset \
+           chartpresenter \
+           xypointlabelcache \
+           candlestickcolumns \
+           glxyseriesdata \
            qlegend \
            qareaseries \
            cmake \
            qcandlestickmodelmapper \
            qcandlestickseries \
-           qcandlestickset
+           qcandlestickset \
+           qboxset
 
 !contains(QT_COORD_TYPE, float): {
     SUBDIRS += \
@@ -41,5 +46,9 @@ qtHaveModule(quick) {
 
 !contains(QT_CONFIG, private_tests): SUBDIRS -= \
     domain \
-    chartdataset
+    chartdataset \
+    chartpresenter \
+    xypointlabelcache \
+    candlestickcolumns \
+    glxyseriesdata
 
@@ -0,0 +1,427 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+#include <private/candlestickcolumns_p.h>
+#include <private/candlestickpyramid_p.h>
+#include <private/candlesticktimestampindex_p.h>
+#include <cmath>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_CandlestickColumns : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void pyramidLevels();
+    void pyramidAppend();
+    void pyramidParallel();
+    void combineRuns_data();
+    void combineRuns();
+    void timestampIndex();
+    void timestampIndexDuplicates();
+    void timestampIndexBulkInsert();
+    void timestampIndexRandom();
+};
+
+// Bars 10 to 50 apart with a long gap every 997 bars, so that some buckets of each level are
+// empty. The timestamps are whole multiples of the smallest gap, so bucket indices are exact.
+static CandlestickColumns generateColumns(int count)
+{
+    QVector<qreal> timestamps(count);
+    QVector<qreal> open(count);
+    QVector<qreal> high(count);
+    QVector<qreal> low(count);
+    QVector<qreal> close(count);
+    qreal timestamp = 1000.0;
+    for (int i = 0; i < count; ++i) {
+        timestamps[i] = timestamp;
+        open[i] = (i * 37) % 101;
+        close[i] = (i * 53) % 103;
+        high[i] = qMax(open.at(i), close.at(i)) + (i * 13) % 7;
+        low[i] = qMin(open.at(i), close.at(i)) - (i * 17) % 11;
+        timestamp += (i % 997 == 996) ? 10000.0 : 10.0 * (1 + (i * 4) % 5);
+    }
+    CandlestickColumns columns;
+    columns.set(timestamps, open, high, low, close);
+    return columns;
+}
+
+// Combines the bars of each bucket of the period directly from the column data: the open of
+// the first bar, the highest high, the lowest low, and the close of the last bar.
+static CandlestickPyramid::Level bucketLevel(const CandlestickColumns &columns, qreal period)
+{
+    CandlestickPyramid::Level level;
+    const qreal origin = columns.timestamps().first();
+    for (int i = 0; i < columns.count(); ++i) {
+        const qint64 bucket = qint64(std::floor((columns.timestamps().at(i) - origin) / period));
+        if (!level.buckets.isEmpty() && level.buckets.last() == bucket) {
+            level.high.last() = qMax(level.high.last(), columns.high().at(i));
+            level.low.last() = qMin(level.low.last(), columns.low().at(i));
+            level.close.last() = columns.close().at(i);
+        } else {
+            level.timestamps.append(origin + bucket * period);
+            level.buckets.append(bucket);
+            level.open.append(columns.open().at(i));
+            level.high.append(columns.high().at(i));
+            level.low.append(columns.low().at(i));
+            level.close.append(columns.close().at(i));
+        }
+    }
+    return level;
+}
+
+static bool sameLevel(const CandlestickPyramid::Level &a, const CandlestickPyramid::Level &b)
+{
+    return a.timestamps == b.timestamps && a.buckets == b.buckets && a.open == b.open
+            && a.high == b.high && a.low == b.low && a.close == b.close;
+}
+
+static bool samePyramid(const CandlestickPyramid &a, const CandlestickPyramid &b)
+{
+    if (a.levelCount() != b.levelCount())
+        return false;
+    for (int level = 1; level < a.levelCount(); ++level) {
+        if (a.period(level) != b.period(level) || !sameLevel(a.level(level), b.level(level)))
+            return false;
+    }
+    return true;
+}
+
+void tst_CandlestickColumns::pyramidLevels()
+{
+    const CandlestickColumns columns = generateColumns(5000);
+    QCOMPARE(columns.timePeriod(), 10.0);
+
+    CandlestickPyramid pyramid;
+    pyramid.update(columns);
+    QCOMPARE(pyramid.levelCount(), 4);
+    QCOMPARE(pyramid.period(0), 10.0);
+
+    for (int level = 1; level < pyramid.levelCount(); ++level) {
+        QCOMPARE(pyramid.period(level), 10.0 * std::pow(4.0, level));
+        const CandlestickPyramid::Level expected = bucketLevel(columns, pyramid.period(level));
+        QVERIFY(sameLevel(pyramid.level(level), expected));
+        if (level > 1)
+            QVERIFY(expected.buckets.count() < pyramid.level(level - 1).buckets.count());
+    }
+    QVERIFY(pyramid.level(pyramid.levelCount() - 1).buckets.count() <= 512);
+
+    QCOMPARE(pyramid.selectLevel(10.0), 0);
+    QCOMPARE(pyramid.selectLevel(41.0), 2);
+    QCOMPARE(pyramid.selectLevel(1.0e9), 3);
+}
+
+void tst_CandlestickColumns::pyramidAppend()
+{
+    const CandlestickColumns all = generateColumns(5000);
+    const int initialCount = 4000;
+
+    CandlestickColumns columns;
+    QVERIFY(columns.set(all.timestamps().mid(0, initialCount), all.open().mid(0, initialCount),
+                        all.high().mid(0, initialCount), all.low().mid(0, initialCount),
+                        all.close().mid(0, initialCount)));
+    CandlestickPyramid pyramid;
+    pyramid.update(columns);
+    QCOMPARE(pyramid.levelCount(), 4);
+
+    for (int i = initialCount; i < all.count(); ++i) {
+        columns.append(all.timestamps().at(i), all.open().at(i), all.high().at(i),
+                       all.low().at(i), all.close().at(i));
+        pyramid.append(columns, true);
+    }
+    // The levels are compared without calling update(), which would rebuild a pyramid that
+    // append() invalidated.
+    CandlestickPyramid rebuilt;
+    rebuilt.update(all);
+    QVERIFY(samePyramid(pyramid, rebuilt));
+}
+
+void tst_CandlestickColumns::pyramidParallel()
+{
+    const CandlestickColumns columns = generateColumns(150000);
+
+    CandlestickPyramid serial;
+    serial.build(columns, 1);
+    QVERIFY(serial.levelCount() > 1);
+    for (int level = 1; level < serial.levelCount(); ++level)
+        QVERIFY(sameLevel(serial.level(level), bucketLevel(columns, serial.period(level))));
+
+    const int chunkCounts[] = { 2, 7, 64, 1000 };
+    for (int i = 0; i < int(sizeof(chunkCounts) / sizeof(chunkCounts[0])); ++i) {
+        CandlestickPyramid chunked;
+        chunked.build(columns, chunkCounts[i]);
+        QVERIFY2(samePyramid(chunked, serial), QByteArray::number(chunkCounts[i]).constData());
+    }
+
+    // Large data is built in chunks by default.
+    CandlestickPyramid updated;
+    updated.update(columns);
+    QVERIFY(samePyramid(updated, serial));
+}
+
+void tst_CandlestickColumns::combineRuns_data()
+{
+    QTest::addColumn<bool>("categories");
+    QTest::addColumn<qreal>("span");
+    QTest::addColumn<int>("first");
+    QTest::addColumn<int>("last");
+
+    QTest::newRow("timestamps") << false << 75.0 << 0 << 3000;
+    QTest::newRow("timestamps window") << false << 230.0 << 1234 << 2345;
+    QTest::newRow("timestamps across gap") << false << 1000.0 << 900 << 1100;
+    QTest::newRow("categories") << true << 7.0 << 0 << 3000;
+    QTest::newRow("categories window") << true << 4.0 << 13 << 101;
+}
+
+void tst_CandlestickColumns::combineRuns()
+{
+    QFETCH(bool, categories);
+    QFETCH(qreal, span);
+    QFETCH(int, first);
+    QFETCH(int, last);
+
+    const CandlestickColumns columns = generateColumns(3000);
+    const qreal origin = categories ? 0.0 : columns.timestamps().first();
+    CandlestickPyramid::Level runs;
+    CandlestickPyramid::combineRuns(categories ? 0 : &columns.timestamps(), columns.open(),
+                                    columns.high(), columns.low(), columns.close(), first,
+                                    last, origin, span, runs);
+
+    // Each run is checked against all the bars of the window that fall into its bucket
+    int barCount = 0;
+    for (int run = 0; run < runs.buckets.count(); ++run) {
+        const qint64 bucket = runs.buckets.at(run);
+        if (run > 0)
+            QVERIFY(bucket > runs.buckets.at(run - 1));
+        QCOMPARE(runs.timestamps.at(run), origin + bucket * span);
+        int firstBar = -1;
+        int lastBar = -1;
+        qreal high = -qInf();
+        qreal low = qInf();
+        for (int i = first; i < last; ++i) {
+            const qreal position = categories ? qreal(i) : columns.timestamps().at(i);
+            if (qint64(std::floor((position - origin) / span)) != bucket)
+                continue;
+            if (firstBar < 0)
+                firstBar = i;
+            lastBar = i;
+            high = qMax(high, columns.high().at(i));
+            low = qMin(low, columns.low().at(i));
+            barCount++;
+        }
+        QVERIFY(firstBar >= 0);
+        QCOMPARE(runs.open.at(run), columns.open().at(firstBar));
+        QCOMPARE(runs.high.at(run), high);
+        QCOMPARE(runs.low.at(run), low);
+        QCOMPARE(runs.close.at(run), columns.close().at(lastBar));
+    }
+    // Every bar of the window belongs to exactly one run
+    QCOMPARE(barCount, last - first);
+
+    // The runs are aligned to the origin, so combining a window that starts with a run gives
+    // the same runs from there on.
+    if (runs.buckets.count() > 2) {
+        int second = first;
+        while (second < last) {
+            const qreal position = categories ? qreal(second) : columns.timestamps().at(second);
+            if (qint64(std::floor((position - origin) / span)) == runs.buckets.at(1))
+                break;
+            second++;
+        }
+        CandlestickPyramid::Level laterRuns;
+        CandlestickPyramid::combineRuns(categories ? 0 : &columns.timestamps(), columns.open(),
+                                        columns.high(), columns.low(), columns.close(),
+                                        second, last, origin, span, laterRuns);
+        QCOMPARE(laterRuns.buckets, runs.buckets.mid(1));
+        QCOMPARE(laterRuns.open, runs.open.mid(1));
+        QCOMPARE(laterRuns.high, runs.high.mid(1));
+        QCOMPARE(laterRuns.low, runs.low.mid(1));
+        QCOMPARE(laterRuns.close, runs.close.mid(1));
+    }
+}
+
+void tst_CandlestickColumns::timestampIndex()
+{
+    CandlestickTimestampIndex index;
+    QCOMPARE(index.count(), 0);
+    QCOMPARE(index.minimumPeriod(), 0.0);
+
+    index.insert(0.0);
+    QCOMPARE(index.count(), 1);
+    QCOMPARE(index.minimumPeriod(), 0.0);
+    index.insert(100.0);
+    QCOMPARE(index.minimumPeriod(), 100.0);
+    index.insert(30.0);
+    QCOMPARE(index.minimumPeriod(), 30.0);
+    index.insert(50.0);
+    QCOMPARE(index.minimumPeriod(), 20.0);
+    index.insert(-40.0);
+    QCOMPARE(index.count(), 5);
+    QCOMPARE(index.minimumPeriod(), 20.0);
+
+    // Removing the timestamp next to the smallest gap merges its gaps.
+    index.remove(50.0);
+    QCOMPARE(index.minimumPeriod(), 30.0);
+    index.remove(30.0);
+    QCOMPARE(index.minimumPeriod(), 40.0);
+    index.remove(0.0);
+    QCOMPARE(index.minimumPeriod(), 140.0);
+
+    // Timestamps that are not in the index are ignored.
+    index.remove(70.0);
+    QCOMPARE(index.count(), 2);
+    QCOMPARE(index.minimumPeriod(), 140.0);
+
+    index.remove(-40.0);
+    QCOMPARE(index.count(), 1);
+    QCOMPARE(index.minimumPeriod(), 0.0);
+
+    index.clear();
+    QCOMPARE(index.count(), 0);
+    index.insert(5.0);
+    index.insert(7.0);
+    QCOMPARE(index.minimumPeriod(), 2.0);
+}
+
+void tst_CandlestickColumns::timestampIndexDuplicates()
+{
+    CandlestickTimestampIndex index;
+    index.insert(10.0);
+    index.insert(20.0);
+    index.insert(40.0);
+    QCOMPARE(index.minimumPeriod(), 10.0);
+
+    // Sets with the same timestamp have no time period between them.
+    index.insert(20.0);
+    index.insert(20.0);
+    QCOMPARE(index.count(), 5);
+    QCOMPARE(index.minimumPeriod(), 0.0);
+    index.remove(20.0);
+    QCOMPARE(index.minimumPeriod(), 0.0);
+    index.remove(20.0);
+    QCOMPARE(index.count(), 3);
+    QCOMPARE(index.minimumPeriod(), 10.0);
+
+    // The last set with a timestamp takes its gaps along.
+    index.remove(20.0);
+    QCOMPARE(index.count(), 2);
+    QCOMPARE(index.minimumPeriod(), 30.0);
+    index.remove(20.0);
+    QCOMPARE(index.count(), 2);
+    QCOMPARE(index.minimumPeriod(), 30.0);
+}
+
+// Returns the smallest distance between adjacent timestamps computed from a sorted copy.
+static qreal bruteForceMinimumPeriod(QList<qreal> timestamps)
+{
+    std::sort(timestamps.begin(), timestamps.end());
+    qreal period = 0.0;
+    for (int i = 1; i < timestamps.count(); ++i) {
+        const qreal gap = timestamps.at(i) - timestamps.at(i - 1);
+        if (i == 1 || gap < period)
+            period = gap;
+    }
+    return period;
+}
+
+void tst_CandlestickColumns::timestampIndexBulkInsert()
+{
+    CandlestickTimestampIndex index;
+    QList<qreal> timestamps;
+
+    // Merged with the existing timestamps
+    QVector<qreal> added;
+    for (int i = 0; i < 100; ++i)
+        added.append((i * 37) % 100 * 10.0);
+    index.insert(added);
+    timestamps += added.toList();
+    QCOMPARE(index.count(), 100);
+    QCOMPARE(index.minimumPeriod(), 10.0);
+
+    // Inserted one by one, including a duplicate
+    added.clear();
+    added << 995.0 << 500.0 << -1.0;
+    index.insert(added);
+    timestamps += added.toList();
+    QCOMPARE(index.count(), timestamps.count());
+    QCOMPARE(index.minimumPeriod(), bruteForceMinimumPeriod(timestamps));
+    QCOMPARE(index.minimumPeriod(), 0.0);
+
+    index.remove(500.0);
+    timestamps.removeOne(500.0);
+    QCOMPARE(index.minimumPeriod(), 1.0);
+    index.remove(-1.0);
+    timestamps.removeOne(-1.0);
+    QCOMPARE(index.minimumPeriod(), 5.0);
+    index.remove(995.0);
+    timestamps.removeOne(995.0);
+    QCOMPARE(index.minimumPeriod(), bruteForceMinimumPeriod(timestamps));
+    QCOMPARE(index.minimumPeriod(), 10.0);
+
+    // Merged again, with timestamps that duplicate existing ones
+    added.clear();
+    for (int i = 0; i < 50; ++i)
+        added.append(i * 20.0 + 5.0);
+    added << 0.0 << 990.0;
+    index.insert(added);
+    timestamps += added.toList();
+    QCOMPARE(index.count(), timestamps.count());
+    QCOMPARE(index.minimumPeriod(), 0.0);
+    index.remove(0.0);
+    index.remove(990.0);
+    timestamps.removeOne(0.0);
+    timestamps.removeOne(990.0);
+    QCOMPARE(index.minimumPeriod(), bruteForceMinimumPeriod(timestamps));
+    QCOMPARE(index.minimumPeriod(), 5.0);
+}
+
+void tst_CandlestickColumns::timestampIndexRandom()
+{
+    CandlestickTimestampIndex index;
+    QList<qreal> timestamps;
+
+    for (int i = 0; i < 2000; ++i) {
+        const qreal timestamp = (i * 7919) % 211;
+        if (timestamps.count() > 2 && (i * 104729) % 3 == 0) {
+            const qreal removed = timestamps.at((i * 31) % timestamps.count());
+            index.remove(removed);
+            timestamps.removeOne(removed);
+        } else {
+            index.insert(timestamp);
+            timestamps.append(timestamp);
+        }
+        QCOMPARE(index.count(), timestamps.count());
+        QCOMPARE(index.minimumPeriod(), bruteForceMinimumPeriod(timestamps));
+    }
+}
+
+QTEST_MAIN(tst_CandlestickColumns)
+
+#include "tst_candlestickcolumns.moc"
@@ -46,6 +46,7 @@
 #include <QtCharts/qstackedbarseries.h>
 #include <private/chartdataset_p.h>
 #include <private/abstractdomain_p.h>
+#include <private/glxyseriesdata_p.h>
 #include <tst_definitions.h>
 
 QT_CHARTS_USE_NAMESPACE
@@ -87,6 +88,7 @@ private Q_SLOTS:
     void detachAxis_data();
     void detachAxis();
     void domainChangePreservesRanges();
+    void glSeriesDataDirtyRange();
 
 private:
     void compareDomain(QAbstractSeries *series, qreal minX, qreal maxX,
@@ -439,6 +441,59 @@ void tst_ChartDataSet::domainChangePreservesRanges()
     compareDomain(line, 4.0, 8.0, 3.0, 7.0);
 }
 
+void tst_ChartDataSet::glSeriesDataDirtyRange()
+{
+    QLineSeries *line = new QLineSeries(this);
+    for (int i = 0; i < 10; i++)
+        line->append(i, i);
+    m_dataset->addSeries(line);
+    AbstractDomain *domain = m_dataset->domainForSeries(line);
+
+    GLXYSeriesDataManager manager;
+    manager.setPoints(line, domain);
+    GLXYSeriesData *data = manager.dataMap().value(line);
+    QVERIFY(data);
+    QCOMPARE(data->array.size(), 20);
+    QVERIFY(data->dirty);
+    QVERIFY(data->dirtyCount < 0);
+    manager.clearAllDirty();
+    QVERIFY(!data->dirty);
+    QCOMPARE(data->dirtyCount, 0);
+
+    // Appending a point dirties only its vertex
+    line->append(10, 20);
+    manager.updatePoints(line, domain, 10, 1);
+    QVERIFY(data->dirty);
+    QCOMPARE(data->array.size(), 22);
+    QCOMPARE(data->array.at(20), 10.0f);
+    QCOMPARE(data->array.at(21), 20.0f);
+    QCOMPARE(data->dirtyIndex, 10);
+    QCOMPARE(data->dirtyCount, 1);
+
+    // Ranges are merged until the data is uploaded
+    line->replace(2, 2, -2);
+    manager.updatePoints(line, domain, 2, 1);
+    QCOMPARE(data->array.at(5), -2.0f);
+    QCOMPARE(data->dirtyIndex, 2);
+    QCOMPARE(data->dirtyCount, 9);
+    manager.clearAllDirty();
+
+    // Domain changes don't touch the vertices of value axes
+    domain->setRange(0, 100, 0, 100);
+    manager.updatePoints(line, domain, 0, 0);
+    QVERIFY(data->dirty);
+    QCOMPARE(data->dirtyCount, 0);
+    QCOMPARE(data->min, QVector2D(0, 0));
+    QCOMPARE(data->delta, QVector2D(50, 50));
+    manager.clearAllDirty();
+
+    // Removing points needs a full upload
+    line->remove(0);
+    manager.updatePoints(line, domain, 0, 1);
+    QCOMPARE(data->array.size(), 20);
+    QVERIFY(data->dirtyCount < 0);
+}
+
 void tst_ChartDataSet::compareDomain(QAbstractSeries *series, qreal minX, qreal maxX,
                                      qreal minY, qreal maxY) const
 {
@@ -0,0 +1,257 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+#include <private/chartpresenter_p.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_ChartPresenter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void plainTextBoundingRect_data();
+    void plainTextBoundingRect();
+    void richTextBoundingRect_data();
+    void richTextBoundingRect();
+    void textBoundingRectCache();
+    void truncatedText_data();
+    void truncatedText();
+};
+
+static QList<QFont> testFonts()
+{
+    QList<QFont> fonts;
+    fonts << QFont();
+    fonts << QFont(QStringLiteral("Arial"), 12);
+    QFont boldItalic(QStringLiteral("Times"), 20, QFont::Bold, true);
+    fonts << boldItalic;
+    QFont pixelFont;
+    pixelFont.setPixelSize(9);
+    fonts << pixelFont;
+    return fonts;
+}
+
+static void addTextRows(const QStringList &texts)
+{
+    QTest::addColumn<QFont>("font");
+    QTest::addColumn<QString>("text");
+
+    const QList<QFont> fonts = testFonts();
+    for (int i = 0; i < fonts.size(); i++) {
+        foreach (const QString &text, texts) {
+            const QByteArray name = QByteArray::number(i) + " " + text.toUtf8();
+            QTest::newRow(name.constData()) << fonts.at(i) << text;
+        }
+    }
+}
+
+// Text layout works in fixed point with 1/64 pixel precision.
+static void compareRects(const QRectF &actual, const QRectF &expected)
+{
+    const qreal precision = 1.0 / 64;
+    QVERIFY2(qAbs(actual.x() - expected.x()) <= precision
+             && qAbs(actual.y() - expected.y()) <= precision
+             && qAbs(actual.width() - expected.width()) <= precision
+             && qAbs(actual.height() - expected.height()) <= precision,
+             qPrintable(QString::fromLatin1("(%1, %2 %3x%4) != (%5, %6 %7x%8)")
+                        .arg(actual.x()).arg(actual.y()).arg(actual.width())
+                        .arg(actual.height()).arg(expected.x()).arg(expected.y())
+                        .arg(expected.width()).arg(expected.height())));
+}
+
+void tst_ChartPresenter::plainTextBoundingRect_data()
+{
+    addTextRows(QStringList()
+                << QStringLiteral("x")
+                << QStringLiteral("0.5")
+                << QStringLiteral("1234567")
+                << QStringLiteral("Label")
+                << QStringLiteral("a b c")
+                << QStringLiteral("-12.5e+3")
+                << QString::fromUtf8("Wij\xc3\xa9 \xc3\x85ngstr\xc3\xb6m"));
+}
+
+void tst_ChartPresenter::plainTextBoundingRect()
+{
+    QFETCH(QFont, font);
+    QFETCH(QString, text);
+
+    QVERIFY(ChartPresenter::isPlainSingleLine(text));
+    const QRectF richRect = ChartPresenter::richTextBoundingRect(font, text);
+    compareRects(ChartPresenter::plainTextBoundingRect(font, text), richRect);
+    compareRects(ChartPresenter::textBoundingRect(font, text), richRect);
+}
+
+void tst_ChartPresenter::richTextBoundingRect_data()
+{
+    addTextRows(QStringList()
+                << QStringLiteral("<b>bold</b>")
+                << QStringLiteral("x<sup>2</sup>")
+                << QStringLiteral("a&amp;b")
+                << QStringLiteral("line 1<br>line 2")
+                << QStringLiteral("two\nlines")
+                << QStringLiteral("tab\tseparated")
+                << QStringLiteral("double  space")
+                << QStringLiteral(" leading")
+                << QStringLiteral("trailing "));
+}
+
+void tst_ChartPresenter::richTextBoundingRect()
+{
+    QFETCH(QFont, font);
+    QFETCH(QString, text);
+
+    QVERIFY(!ChartPresenter::isPlainSingleLine(text));
+    compareRects(ChartPresenter::textBoundingRect(font, text),
+                 ChartPresenter::richTextBoundingRect(font, text));
+}
+
+void tst_ChartPresenter::textBoundingRectCache()
+{
+    // Labels that no other test measures, so that the first pass can't hit the cache
+    QStringList labels;
+    for (int i = 0; i < 20; i++)
+        labels << QStringLiteral("cache label %1").arg(i);
+    labels << QStringLiteral("<i>cache label</i>");
+    const QFont font;
+
+    ChartPresenter::resetTextBoundingRectCacheStatistics();
+    QCOMPARE(ChartPresenter::textBoundingRectCacheHits(), quint64(0));
+    QCOMPARE(ChartPresenter::textBoundingRectCacheMisses(), quint64(0));
+
+    QList<QRectF> rects;
+    foreach (const QString &label, labels)
+        rects << ChartPresenter::textBoundingRect(font, label);
+    QCOMPARE(ChartPresenter::textBoundingRectCacheHits(), quint64(0));
+    QCOMPARE(ChartPresenter::textBoundingRectCacheMisses(), quint64(labels.size()));
+
+    // Measuring the same labels again, also rotated, is answered from the cache
+    for (int i = 0; i < labels.size(); i++) {
+        QCOMPARE(ChartPresenter::textBoundingRect(font, labels.at(i)), rects.at(i));
+        ChartPresenter::textBoundingRect(font, labels.at(i), 90.0);
+    }
+    QCOMPARE(ChartPresenter::textBoundingRectCacheHits(), quint64(2 * labels.size()));
+    QCOMPARE(ChartPresenter::textBoundingRectCacheMisses(), quint64(labels.size()));
+
+    // A different font is a different key
+    QFont boldFont;
+    boldFont.setBold(true);
+    ChartPresenter::textBoundingRect(boldFont, labels.first());
+    QCOMPARE(ChartPresenter::textBoundingRectCacheMisses(), quint64(labels.size() + 1));
+}
+
+// Truncates text the way ChartPresenter::truncatedText() does, but tries every length from the
+// longest to the shortest instead of searching for the best fit.
+static QString linearTruncation(const QFont &font, const QString &text, qreal angle,
+                                qreal maxWidth, qreal maxHeight, QRectF &boundingRect)
+{
+    const QString ellipsis(QStringLiteral("..."));
+    QRegExp entityMatcher(QStringLiteral("&#?[0-9a-zA-Z]*;$"));
+
+    boundingRect = ChartPresenter::textBoundingRect(font, text, angle);
+    if (boundingRect.width() <= maxWidth && boundingRect.height() <= maxHeight)
+        return text;
+
+    QString truncated(text);
+    while (truncated.length() > 1) {
+        int chopIndex = -1;
+        if (truncated.endsWith(QLatin1Char('>')))
+            chopIndex = truncated.lastIndexOf(QLatin1Char('<'));
+        else if (truncated.endsWith(QLatin1Char(';')))
+            chopIndex = entityMatcher.indexIn(truncated, 0);
+        truncated.chop(chopIndex != -1 ? truncated.length() - chopIndex : 1);
+
+        const QString candidate = truncated + ellipsis;
+        boundingRect = ChartPresenter::textBoundingRect(font, candidate, angle);
+        if (boundingRect.width() <= maxWidth && boundingRect.height() <= maxHeight)
+            return candidate;
+    }
+    boundingRect = ChartPresenter::textBoundingRect(font, ellipsis, angle);
+    return ellipsis;
+}
+
+void tst_ChartPresenter::truncatedText_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<qreal>("angle");
+    // The available size as a fraction of the bounding rect of the whole text
+    QTest::addColumn<qreal>("widthFactor");
+    QTest::addColumn<qreal>("heightFactor");
+
+    QTest::newRow("plain") << QStringLiteral("A rather long axis label") << 0.0 << 0.6 << 1.0;
+    QTest::newRow("markup") << QStringLiteral("<b>A rather long</b> axis label") << 0.0 << 0.5
+                            << 1.0;
+    QTest::newRow("entity") << QStringLiteral("Salt &amp; pepper &amp; vinegar") << 0.0 << 0.55
+                            << 1.0;
+    QTest::newRow("rotated") << QStringLiteral("A rather long axis label") << 45.0 << 0.7 << 0.7;
+    QTest::newRow("vertical") << QStringLiteral("A rather long axis label") << -90.0 << 1.0
+                              << 0.5;
+    QTest::newRow("fits") << QStringLiteral("Short") << 0.0 << 1.0 << 1.0;
+    QTest::newRow("nothing fits") << QStringLiteral("A rather long axis label") << 0.0 << 0.01
+                                  << 1.0;
+}
+
+void tst_ChartPresenter::truncatedText()
+{
+    QFETCH(QString, text);
+    QFETCH(qreal, angle);
+    QFETCH(qreal, widthFactor);
+    QFETCH(qreal, heightFactor);
+
+    const QFont font;
+    const QRectF fullRect = ChartPresenter::textBoundingRect(font, text, angle);
+    const qreal maxWidth = fullRect.width() * widthFactor;
+    const qreal maxHeight = fullRect.height() * heightFactor;
+
+    QRectF expectedRect;
+    const QString expected = linearTruncation(font, text, angle, maxWidth, maxHeight,
+                                              expectedRect);
+    QRectF boundingRect;
+    const QString truncated = ChartPresenter::truncatedText(font, text, angle, maxWidth,
+                                                            maxHeight, boundingRect);
+    QCOMPARE(truncated, expected);
+    QCOMPARE(boundingRect, expectedRect);
+    if (widthFactor >= 1.0 && heightFactor >= 1.0)
+        QCOMPARE(truncated, text);
+    else if (widthFactor < 0.1)
+        QCOMPARE(truncated, QStringLiteral("..."));
+    else
+        QVERIFY(truncated != text && truncated.endsWith(QStringLiteral("...")));
+
+    // The same key is answered from the memoized result
+    QRectF cachedRect;
+    QCOMPARE(ChartPresenter::truncatedText(font, text, angle, maxWidth, maxHeight, cachedRect),
+             truncated);
+    QCOMPARE(cachedRect, boundingRect);
+}
+
+QTEST_MAIN(tst_ChartPresenter)
+
+#include "tst_chartpresenter.moc"
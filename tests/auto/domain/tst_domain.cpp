@@ -28,6 +28,10 @@
 ****************************************************************************/
 #include <QtTest/QtTest>
 #include <private/xydomain_p.h>
+#include <private/domaintransform_p.h>
+#include <private/xypolardomain_p.h>
+#include <private/xlogypolardomain_p.h>
+#include <private/xyseriescolumns_p.h>
 #include <private/qabstractaxis_p.h>
 #include <tst_definitions.h>
 
@@ -128,6 +132,14 @@ private Q_SLOTS:
     void zoomOut();
     void move_data();
     void move();
+    void calculateGeometryPoints_data();
+    void calculateGeometryPoints();
+    void calculateGeometryPointsNonFinite();
+    void calculateGeometryPointsBenchmark();
+    void mapAffine_data();
+    void mapAffine();
+    void polarAngularCoordinates_data();
+    void polarAngularCoordinates();
 };
 
 void tst_Domain::initTestCase()
@@ -728,5 +740,216 @@ void tst_Domain::move()
     TRY_COMPARE(spy2.count(), (dy != 0 ? 1 : 0));
 }
 
+void tst_Domain::calculateGeometryPoints_data()
+{
+    QTest::addColumn<bool>("reverseX");
+    QTest::addColumn<bool>("reverseY");
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("plain") << false << false << 1001;
+    QTest::newRow("reverseX") << true << false << 1001;
+    QTest::newRow("reverseY") << false << true << 1001;
+    QTest::newRow("reverseXY") << true << true << 1001;
+    QTest::newRow("single") << false << false << 1;
+    QTest::newRow("empty") << false << false << 0;
+}
+
+void tst_Domain::calculateGeometryPoints()
+{
+    QFETCH(bool, reverseX);
+    QFETCH(bool, reverseY);
+    QFETCH(int, count);
+
+    XYDomain domain;
+    domain.setRange(-50, 150, -20, 80);
+    domain.setSize(QSizeF(640, 480));
+    domain.setReverseX(reverseX);
+    domain.setReverseY(reverseY);
+
+    QVector<QPointF> points;
+    for (int i = 0; i < count; i++)
+        points << QPointF(i * 0.25 - 30, qSin(i * 0.01) * 40);
+
+    const QVector<QPointF> result = domain.calculateGeometryPoints(points);
+    QCOMPARE(result.count(), count);
+    for (int i = 0; i < count; i++) {
+        bool ok;
+        const QPointF expected = domain.calculateGeometryPoint(points.at(i), ok);
+        QVERIFY(ok);
+        QVERIFY(qAbs(result.at(i).x() - expected.x()) < 1e-9);
+        QVERIFY(qAbs(result.at(i).y() - expected.y()) < 1e-9);
+    }
+}
+
+void tst_Domain::calculateGeometryPointsNonFinite()
+{
+    XYDomain domain;
+    domain.setRange(0, 100, 0, 100);
+    domain.setSize(QSizeF(100, 100));
+
+    QVector<QPointF> points;
+    for (int i = 0; i < 10; i++)
+        points << QPointF(i, i);
+    QCOMPARE(domain.calculateGeometryPoints(points).count(), points.count());
+
+    // Only the points that are not finite are affected, the rest of the series is still mapped
+    points[7].setY(qInf());
+    points[3].setX(qQNaN());
+    const QVector<QPointF> result = domain.calculateGeometryPoints(points);
+    QCOMPARE(result.count(), points.count());
+    QVERIFY(!qIsFinite(result.at(7).y()));
+    QVERIFY(qIsNaN(result.at(3).x()));
+    for (int i = 0; i < points.count(); i++) {
+        if (i == 3 || i == 7)
+            continue;
+        QCOMPARE(result.at(i), QPointF(i, 100 - i));
+    }
+}
+
+void tst_Domain::calculateGeometryPointsBenchmark()
+{
+    // Reports the cost of mapping one million points.
+    XYDomain domain;
+    domain.setRange(0, 1000000, -1, 1);
+    domain.setSize(QSizeF(1920, 1080));
+
+    QVector<QPointF> points;
+    points.reserve(1000000);
+    for (int i = 0; i < 1000000; i++)
+        points << QPointF(i, qSin(i * 0.001));
+
+    QVector<QPointF> result;
+    QBENCHMARK {
+        result = domain.calculateGeometryPoints(points);
+    }
+    QCOMPARE(result.count(), points.count());
+    bool ok;
+    QCOMPARE(result.last(), domain.calculateGeometryPoint(points.last(), ok));
+}
+
+void tst_Domain::mapAffine_data()
+{
+    QTest::addColumn<qreal>("minX");
+    QTest::addColumn<qreal>("maxX");
+    QTest::addColumn<qreal>("minY");
+    QTest::addColumn<qreal>("maxY");
+    QTest::addColumn<bool>("reverseX");
+    QTest::addColumn<bool>("reverseY");
+    QTest::newRow("small range") << -7.0 << 20.0 << -40.0 << 40.0 << false << false;
+    QTest::newRow("reversed") << -7.0 << 20.0 << -40.0 << 40.0 << true << true;
+    // Timestamps in milliseconds, where the range is tiny compared to the minimum
+    QTest::newRow("1.6e12 + 1") << 1.6e12 << 1.6e12 + 1.0 << 1.6e12 << 1.6e12 + 1.0
+                                << false << false;
+    QTest::newRow("1.6e12 + 1 reversed") << 1.6e12 << 1.6e12 + 1.0 << 1.6e12 << 1.6e12 + 1.0
+                                         << true << true;
+}
+
+void tst_Domain::mapAffine()
+{
+    QFETCH(qreal, minX);
+    QFETCH(qreal, maxX);
+    QFETCH(qreal, minY);
+    QFETCH(qreal, maxY);
+    QFETCH(bool, reverseX);
+    QFETCH(bool, reverseY);
+
+    XYDomain domain;
+    domain.setSize(QSizeF(1000, 500));
+    domain.setRange(minX, maxX, minY, maxY);
+    domain.setReverseX(reverseX);
+    domain.setReverseY(reverseY);
+
+    const qreal scaleX = (reverseX ? -1000 : 1000) / (maxX - minX);
+    const qreal offsetX = reverseX ? 1000 : 0;
+    const qreal scaleY = (reverseY ? 500 : -500) / (maxY - minY);
+    const qreal offsetY = reverseY ? 0 : 500;
+
+    // The vector kernels map a pair of points per step, so check all tail lengths against
+    // the scalar calculation.
+    for (int count = 0; count < 8; count++) {
+        QVector<QPointF> points;
+        for (int i = 0; i < count; i++) {
+            points << QPointF(minX + (maxX - minX) * (i * 0.173 - 0.1),
+                              minY + (maxY - minY) * (qSin(i) + 1) / 2);
+        }
+
+        // The incremental paths of the items map single points with calculateGeometryPoint(),
+        // so the points mapped in bulk must be identical to them.
+        const QVector<QPointF> geometryPoints = domain.calculateGeometryPoints(points);
+        QCOMPARE(geometryPoints.count(), count);
+        for (int i = 0; i < count; i++) {
+            bool ok;
+            const QPointF point = domain.calculateGeometryPoint(points.at(i), ok);
+            QVERIFY(ok);
+            QVERIFY(geometryPoints.at(i).x() == point.x());
+            QVERIFY(geometryPoints.at(i).y() == point.y());
+        }
+
+        QVector<QPointF> result(count);
+        QVERIFY(DomainTransform::mapAffine(points.constData(), result.data(), count,
+                                           minX, scaleX, offsetX, minY, scaleY, offsetY));
+        for (int i = 0; i < count; i++) {
+            QVERIFY(result.at(i).x() == (points.at(i).x() - minX) * scaleX + offsetX);
+            QVERIFY(result.at(i).y() == (points.at(i).y() - minY) * scaleY + offsetY);
+        }
+
+        // Mapping in place gives the same result
+        QVERIFY(DomainTransform::mapAffine(points.constData(), points.data(), count,
+                                           minX, scaleX, offsetX, minY, scaleY, offsetY));
+        QCOMPARE(points, result);
+
+        if (count > 0) {
+            points.last().setX(qInf());
+            QVERIFY(!DomainTransform::mapAffine(points.constData(), result.data(), count,
+                                                minX, scaleX, offsetX, minY, scaleY, offsetY));
+        }
+    }
+}
+
+void tst_Domain::polarAngularCoordinates_data()
+{
+    QTest::addColumn<qreal>("minX");
+    QTest::addColumn<qreal>("maxX");
+    QTest::newRow("0 - 169") << 0.0 << 169.0;
+    QTest::newRow("0 - 100") << 0.0 << 100.0;
+    QTest::newRow("-3.7 - 12.1") << -3.7 << 12.1;
+    QTest::newRow("1000 - 1007") << 1000.0 << 1007.0;
+    QTest::newRow("0.1 - 0.3") << 0.1 << 0.3;
+}
+
+void tst_Domain::polarAngularCoordinates()
+{
+    QFETCH(qreal, minX);
+    QFETCH(qreal, maxX);
+
+    QVector<QPointF> points;
+    for (int i = 0; i <= 1000; i++)
+        points.append(QPointF(minX + (maxX - minX) * i / 1000, 1.0));
+    points << QPointF(minX, 1.0) << QPointF(maxX, 1.0) << QPointF(minX - 1.0, 1.0)
+           << QPointF(maxX + 1.0, 1.0);
+    const XYSeriesColumns columns(points);
+
+    XYPolarDomain xyDomain;
+    xyDomain.setRange(minX, maxX, 0.0, 10.0);
+    XLogYPolarDomain xLogYDomain;
+    xLogYDomain.setRange(minX, maxX, 1.0, 10.0);
+    const PolarDomain *domains[] = { &xyDomain, &xLogYDomain };
+
+    // The angles are compared exactly, as the line item compares them to 0 and 360 degrees.
+    for (int d = 0; d < 2; d++) {
+        const QVector<qreal> angles = domains[d]->toAngularCoordinates(columns);
+        QCOMPARE(angles.count(), points.count());
+        for (int i = 0; i < points.count(); i++) {
+            bool ok;
+            const qreal expected = domains[d]->toAngularCoordinate(points.at(i).x(), ok);
+            QVERIFY2(angles.at(i) == expected,
+                     qPrintable(QString::number(angles.at(i), 'g', 17)
+                                + QLatin1String(" != ")
+                                + QString::number(expected, 'g', 17)));
+        }
+        QVERIFY(angles.at(points.count() - 3) == 360.0);
+    }
+}
+
 QTEST_MAIN(tst_Domain)
 #include "tst_domain.moc"
@@ -0,0 +1,137 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+#include <private/glxyseriesdata_p.h>
+#ifndef QT_NO_OPENGL
+#include <QtGui/QOffscreenSurface>
+#include <QtGui/QOpenGLContext>
+#include <QtGui/QOpenGLBuffer>
+#endif
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_GLXYSeriesData : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void dirtyRange();
+    void upload();
+};
+
+void tst_GLXYSeriesData::dirtyRange()
+{
+    GLXYSeriesData data;
+    // Everything is dirty until the first upload
+    data.addDirtyRange(3, 2);
+    QCOMPARE(data.dirtyCount, -1);
+
+    data.clearDirtyRange();
+    data.addDirtyRange(10, 1);
+    QCOMPARE(data.dirtyIndex, 10);
+    QCOMPARE(data.dirtyCount, 1);
+    data.addDirtyRange(4, 2);
+    QCOMPARE(data.dirtyIndex, 4);
+    QCOMPARE(data.dirtyCount, 7);
+    data.addDirtyRange(6, 0);
+    QCOMPARE(data.dirtyCount, 7);
+
+    data.setAllDirty();
+    QCOMPARE(data.dirtyCount, -1);
+}
+
+#ifndef QT_NO_OPENGL
+static QVector<float> readBuffer(QOpenGLBuffer *vbo, int floatCount)
+{
+    QVector<float> values(floatCount);
+    if (!vbo->read(0, values.data(), floatCount * int(sizeof(float))))
+        values.clear();
+    return values;
+}
+#endif
+
+void tst_GLXYSeriesData::upload()
+{
+#ifdef QT_NO_OPENGL
+    QSKIP("OpenGL is not supported");
+#else
+    QOffscreenSurface surface;
+    surface.create();
+    QOpenGLContext context;
+    if (!context.create() || !context.makeCurrent(&surface))
+        QSKIP("No OpenGL context available");
+
+    QOpenGLBuffer vbo;
+    QVERIFY(vbo.create());
+    QVERIFY(vbo.bind());
+
+    GLXYSeriesData data;
+    for (int i = 0; i < 100; i++)
+        data.array << float(i) << float(i * 2);
+    data.dirty = true;
+    data.upload(&vbo, true);
+    const int vertexSize = 2 * int(sizeof(float));
+    // The buffer has room for appended vertices
+    const int bufferSize = vbo.size();
+    QCOMPARE(bufferSize, 100 * vertexSize * 3 / 2);
+    QVERIFY(!data.dirty);
+    QCOMPARE(data.dirtyCount, 0);
+
+    QVector<float> values = readBuffer(&vbo, 200);
+    if (values.isEmpty())
+        QSKIP("Reading back buffers is not supported");
+    QCOMPARE(values, data.array);
+
+    // Change the first vertex without marking it dirty, so that rewriting it would show
+    data.array[0] = -1.0f;
+    data.array[1] = -1.0f;
+    data.array << 100.0f << 200.0f;
+    data.dirty = true;
+    data.addDirtyRange(100, 1);
+    data.upload(&vbo, false);
+
+    // Only the appended vertex is written, into the existing buffer
+    QCOMPARE(vbo.size(), bufferSize);
+    values = readBuffer(&vbo, 202);
+    QCOMPARE(values.size(), 202);
+    QCOMPARE(values.at(0), 0.0f);
+    QCOMPARE(values.at(1), 0.0f);
+    QCOMPARE(values.at(200), 100.0f);
+    QCOMPARE(values.at(201), 200.0f);
+    QCOMPARE(values.mid(2, 198), data.array.mid(2, 198));
+    QCOMPARE(data.dirtyCount, 0);
+
+    vbo.destroy();
+    context.doneCurrent();
+#endif
+}
+
+QTEST_MAIN(tst_GLXYSeriesData)
+
+#include "tst_glxyseriesdata.moc"
@@ -34,6 +34,8 @@
 #include <QtCharts/QLineSeries>
 #include <QtCharts/QChartView>
 #include <QtCharts/QValueAxis>
+#include <private/areachartitem_p.h>
+#include <private/abstractdomain_p.h>
 #include <tst_definitions.h>
 
 QT_CHARTS_USE_NAMESPACE
@@ -50,6 +52,7 @@ public slots:
 private slots:
     void areaSeries();
     void dynamicEdgeSeriesChange();
+    void shape();
 
 protected:
     QLineSeries *createUpperSeries();
@@ -164,6 +167,82 @@ void tst_QAreaSeries::dynamicEdgeSeriesChange()
     checkPixels(m_backgroundColor, m_backgroundColor, m_backgroundColor);
 }
 
+static AreaChartItem *findAreaChartItem(QChart *chart)
+{
+    foreach (QGraphicsItem *item, chart->scene()->items()) {
+        AreaChartItem *areaItem = qobject_cast<AreaChartItem *>(item->toGraphicsObject());
+        if (areaItem)
+            return areaItem;
+    }
+    return 0;
+}
+
+// The outline of a cartesian area: the upper line points followed by the lower line points in
+// reverse order, or by the baseline corners below the upper line if there is no lower series.
+static QPainterPath expectedShape(AreaChartItem *item)
+{
+    const QVector<QPointF> &upperPoints = item->upperLineItem()->linePoints();
+    QPolygonF polygon(upperPoints);
+    if (item->lowerLineItem()) {
+        const QVector<QPointF> &lowerPoints = item->lowerLineItem()->linePoints();
+        for (int i = lowerPoints.size() - 1; i >= 0; i--)
+            polygon << lowerPoints.at(i);
+    } else {
+        const qreal bottom = item->domain()->size().height();
+        polygon << QPointF(upperPoints.last().x(), bottom)
+                << QPointF(upperPoints.first().x(), bottom);
+    }
+    QPainterPath path;
+    path.addPolygon(polygon);
+    path.closeSubpath();
+    return path;
+}
+
+void tst_QAreaSeries::shape()
+{
+    if (isPolarTest())
+        QSKIP("Polar areas are outlined with the paths of the edge lines");
+
+    QLineSeries *upperSeries = createUpperSeries();
+    QLineSeries *lowerSeries = createLowerSeries();
+    QAreaSeries *series = new QAreaSeries(upperSeries, lowerSeries);
+    m_chart->addSeries(series);
+    series->attachAxis(m_axisX);
+    series->attachAxis(m_axisY);
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    AreaChartItem *item = findAreaChartItem(m_chart);
+    QVERIFY(item);
+    QVERIFY(item->lowerLineItem());
+    QCOMPARE(item->shape().elementCount(), 11);
+    QCOMPARE(item->shape(), expectedShape(item));
+
+    // Only the lower part of the outline changes
+    lowerSeries->replace(2, QPointF(2, 1));
+    QApplication::processEvents();
+    QCOMPARE(item->shape(), expectedShape(item));
+
+    // The upper part grows, and the lower part moves behind it
+    upperSeries->append(4, 8);
+    upperSeries->append(3.5, 9);
+    QApplication::processEvents();
+    QCOMPARE(item->upperLineItem()->linePoints().size(), 7);
+    QCOMPARE(item->shape().elementCount(), 13);
+    QCOMPARE(item->shape(), expectedShape(item));
+
+    // Without a lower series the baseline corners follow the upper points
+    series->setLowerSeries(nullptr);
+    QApplication::processEvents();
+    QVERIFY(!item->lowerLineItem());
+    QCOMPARE(item->shape(), expectedShape(item));
+
+    upperSeries->replace(0, QPointF(0.5, 9));
+    upperSeries->append(3, 8);
+    QApplication::processEvents();
+    QCOMPARE(item->shape(), expectedShape(item));
+}
+
 QLineSeries *tst_QAreaSeries::createUpperSeries()
 {
     QLineSeries *series = new QLineSeries();
@@ -32,6 +32,7 @@
 #include <QtCharts/QBarSet>
 #include <QtCharts/QChartView>
 #include <QtCharts/QChart>
+#include <QtCharts/QLineSeries>
 #include "tst_definitions.h"
 
 QT_CHARTS_USE_NAMESPACE
@@ -83,6 +84,8 @@ private slots:
     void mousePressed();
     void mouseReleased();
     void mouseDoubleClicked();
+    void mouseBatched();
+    void mouseBatchedPassThrough();
 
 private:
     QBarSeries* m_barseries;
@@ -1398,6 +1401,115 @@ void tst_QBarSeries::mouseDoubleClicked()
     QVERIFY(setSpyArg.at(0).toInt() == 0);
 }
 
+void tst_QBarSeries::mouseBatched()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    // Enough bars without labels to be painted without an item per bar
+    QBarSeries *series = new QBarSeries();
+    series->setBarWidth(1.0);
+    QBarSet *set1 = new QBarSet(QString("set 1"));
+    for (int i = 0; i < 2000; i++)
+        *set1 << 10;
+    series->append(set1);
+
+    QSignalSpy seriesSpy(series, SIGNAL(clicked(int,QBarSet*)));
+    QSignalSpy setSpy(set1, SIGNAL(clicked(int)));
+    QSignalSpy seriesHoverSpy(series, SIGNAL(hovered(bool,int,QBarSet*)));
+    QSignalSpy setHoverSpy(set1, SIGNAL(hovered(bool,int)));
+
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    view.chart()->addSeries(series);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    //this is hack since view does not get events otherwise
+    view.setMouseTracking(true);
+
+    // Bars are narrower than a pixel, so allow a neighbouring index
+    const QRectF plotArea = view.chart()->plotArea();
+    const QPoint point = plotArea.center().toPoint();
+    const int expectedIndex = qRound((point.x() - plotArea.left()) * 2000 / plotArea.width() - 0.5);
+
+    QTest::mouseMove(view.viewport(), QPoint(point.x(), plotArea.top() - 5));
+    QTest::mouseMove(view.viewport(), point);
+    QTRY_COMPARE(seriesHoverSpy.count(), 1);
+    QTRY_COMPARE(setHoverSpy.count(), 1);
+    QList<QVariant> hoverSpyArg = seriesHoverSpy.takeFirst();
+    QVERIFY(hoverSpyArg.at(0).toBool() == true);
+    QCOMPARE(qvariant_cast<QBarSet*>(hoverSpyArg.at(2)), set1);
+    const int hoveredIndex = hoverSpyArg.at(1).toInt();
+    QVERIFY(qAbs(hoveredIndex - expectedIndex) <= 1);
+    hoverSpyArg = setHoverSpy.takeFirst();
+    QVERIFY(hoverSpyArg.at(0).toBool() == true);
+    QCOMPARE(hoverSpyArg.at(1).toInt(), hoveredIndex);
+
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, point);
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+    QCOMPARE(seriesSpy.count(), 1);
+    QCOMPARE(setSpy.count(), 1);
+    QList<QVariant> seriesSpyArg = seriesSpy.takeFirst();
+    QCOMPARE(qvariant_cast<QBarSet*>(seriesSpyArg.at(1)), set1);
+    const int index = seriesSpyArg.at(0).toInt();
+    QCOMPARE(index, hoveredIndex);
+    QCOMPARE(setSpy.takeFirst().at(0).toInt(), index);
+
+    // Clicks outside the bars are not handled, and leaving the bars ends the hover
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0,
+                      QPoint(point.x(), plotArea.top() - 5));
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(seriesSpy.count(), 0);
+
+    QTRY_COMPARE(seriesHoverSpy.count(), 1);
+    QTRY_COMPARE(setHoverSpy.count(), 1);
+    hoverSpyArg = seriesHoverSpy.takeFirst();
+    QVERIFY(hoverSpyArg.at(0).toBool() == false);
+    QCOMPARE(hoverSpyArg.at(1).toInt(), hoveredIndex);
+    hoverSpyArg = setHoverSpy.takeFirst();
+    QVERIFY(hoverSpyArg.at(0).toBool() == false);
+    QCOMPARE(hoverSpyArg.at(1).toInt(), hoveredIndex);
+}
+
+void tst_QBarSeries::mouseBatchedPassThrough()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    // A line series below a batched bar series gets the events that do not hit a bar
+    QLineSeries *lineSeries = new QLineSeries();
+    lineSeries->append(0, 0);
+    lineSeries->append(10, 10);
+
+    QBarSeries *barSeries = new QBarSeries();
+    QBarSet *set1 = new QBarSet(QString("set 1"));
+    for (int i = 0; i < 2000; i++)
+        *set1 << 1;
+    set1->replace(0, 10);
+    barSeries->append(set1);
+
+    QSignalSpy lineHoverSpy(lineSeries, SIGNAL(hovered(QPointF,bool)));
+    QSignalSpy barHoverSpy(barSeries, SIGNAL(hovered(bool,int,QBarSet*)));
+
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    view.chart()->addSeries(lineSeries);
+    view.chart()->addSeries(barSeries);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    //this is hack since view does not get events otherwise
+    view.setMouseTracking(true);
+
+    // Bars other than the first one only cover the bottom tenth of the plot area
+    const QPoint point = view.chart()->mapToPosition(QPointF(5, 5), lineSeries).toPoint();
+    QTest::mouseMove(view.viewport(), QPoint(0, point.y()));
+    QTest::mouseMove(view.viewport(), point);
+    QTRY_COMPARE(lineHoverSpy.count(), 1);
+    QVERIFY(lineHoverSpy.takeFirst().at(1).toBool() == true);
+    QCOMPARE(barHoverSpy.count(), 0);
+}
+
 QTEST_MAIN(tst_QBarSeries)
 
 #include "tst_qbarseries.moc"
@@ -0,0 +1,199 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCharts/QBoxSet>
+#include <QtCharts/QBoxPlotSeries>
+#include <QtCharts/QChartView>
+#include <QtTest/QtTest>
+#include <tst_definitions.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_QBoxSet : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void samples_data();
+    void samples();
+    void appendSamples();
+    void setSamples();
+    void seriesStatistics();
+
+private:
+    void compareValues(const QBoxSet &set, const QList<qreal> &expected);
+};
+
+void tst_QBoxSet::compareValues(const QBoxSet &set, const QList<qreal> &expected)
+{
+    QCOMPARE(set.at(QBoxSet::LowerExtreme), expected.at(0));
+    QCOMPARE(set.at(QBoxSet::LowerQuartile), expected.at(1));
+    QCOMPARE(set.at(QBoxSet::Median), expected.at(2));
+    QCOMPARE(set.at(QBoxSet::UpperQuartile), expected.at(3));
+    QCOMPARE(set.at(QBoxSet::UpperExtreme), expected.at(4));
+}
+
+void tst_QBoxSet::samples_data()
+{
+    QTest::addColumn<QList<qreal> >("samples");
+    QTest::addColumn<int>("invalidCount");
+    QTest::addColumn<QList<qreal> >("expected");
+
+    // The quartiles are the medians of the lower and upper half, the middle sample of an odd
+    // count belongs to neither half.
+    QTest::newRow("odd") << (QList<qreal>() << 7 << 1 << 3 << 9 << 5) << 0
+                         << (QList<qreal>() << 1 << 2 << 5 << 8 << 9);
+    QTest::newRow("even") << (QList<qreal>() << 8 << 3 << 1 << 6 << 2 << 7 << 5 << 4) << 0
+                          << (QList<qreal>() << 1 << 2.5 << 4.5 << 6.5 << 8);
+    QTest::newRow("duplicates") << (QList<qreal>() << 2 << 2 << 2 << 3 << 3 << 10) << 0
+                                << (QList<qreal>() << 2 << 2 << 2.5 << 3 << 10);
+    QTest::newRow("single") << (QList<qreal>() << 4) << 0
+                            << (QList<qreal>() << 4 << 4 << 4 << 4 << 4);
+    QTest::newRow("invalid") << (QList<qreal>() << 3 << qQNaN() << 1 << qInf() << 2) << 2
+                             << (QList<qreal>() << 1 << 1 << 2 << 3 << 3);
+}
+
+void tst_QBoxSet::samples()
+{
+    QFETCH(QList<qreal>, samples);
+    QFETCH(int, invalidCount);
+    QFETCH(QList<qreal>, expected);
+
+    for (int i = 0; i < invalidCount; i++)
+        QTest::ignoreMessage(QtWarningMsg, "Ignored NaN, Inf, or -Inf value.");
+
+    QBoxSet set;
+    QSignalSpy spy(&set, SIGNAL(valuesChanged()));
+    set.setSamples(samples);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(set.sampleCount(), samples.count() - invalidCount);
+    compareValues(set, expected);
+}
+
+void tst_QBoxSet::appendSamples()
+{
+    QBoxSet set;
+    QSignalSpy spy(&set, SIGNAL(valuesChanged()));
+
+    // The statistics cover all the batches
+    set.appendSamples(QList<qreal>() << 7 << 1 << 3);
+    set.appendSamples(QList<qreal>() << 9 << 5);
+    QCOMPARE(spy.count(), 2);
+    QCOMPARE(set.sampleCount(), 5);
+    compareValues(set, QList<qreal>() << 1 << 2 << 5 << 8 << 9);
+
+    // Nothing changes if none of the samples is valid
+    QTest::ignoreMessage(QtWarningMsg, "Ignored NaN, Inf, or -Inf value.");
+    QTest::ignoreMessage(QtWarningMsg, "Ignored NaN, Inf, or -Inf value.");
+    set.appendSamples(QList<qreal>() << qQNaN() << -qInf());
+    set.appendSamples(QList<qreal>());
+    QCOMPARE(spy.count(), 2);
+    QCOMPARE(set.sampleCount(), 5);
+    compareValues(set, QList<qreal>() << 1 << 2 << 5 << 8 << 9);
+
+    set.appendSamples(QList<qreal>() << 0 << 10 << 11);
+    QCOMPARE(spy.count(), 3);
+    QCOMPARE(set.sampleCount(), 8);
+    compareValues(set, QList<qreal>() << 0 << 2 << 6 << 9.5 << 11);
+
+    // Batches merged into the sorted samples give the same values as all samples at once
+    QBoxSet mergedSet;
+    QList<qreal> allSamples;
+    for (int batch = 0; batch < 20; batch++) {
+        QList<qreal> samples;
+        for (int i = 0; i < batch * 7 % 11 + 1; i++)
+            samples << (batch * 31 + i * 17) % 23 - 0.5 * batch;
+        allSamples << samples;
+        mergedSet.appendSamples(samples);
+        if (batch % 3 == 0)
+            mergedSet.at(QBoxSet::Median);
+    }
+    QBoxSet referenceSet;
+    referenceSet.setSamples(allSamples);
+    for (int i = 0; i < 5; i++)
+        QCOMPARE(mergedSet.at(i), referenceSet.at(i));
+}
+
+void tst_QBoxSet::setSamples()
+{
+    QBoxSet set(1, 2, 3, 4, 5);
+    set.setSamples(QList<qreal>() << 10 << 20 << 30);
+    compareValues(set, QList<qreal>() << 10 << 10 << 20 << 30 << 30);
+
+    // The previous samples are replaced
+    set.setSamples(QList<qreal>() << 4 << 2);
+    QCOMPARE(set.sampleCount(), 2);
+    compareValues(set, QList<qreal>() << 2 << 2 << 3 << 4 << 4);
+
+    // An explicit value overrides the computed one
+    set.setValue(QBoxSet::Median, 100);
+    compareValues(set, QList<qreal>() << 2 << 2 << 100 << 4 << 4);
+
+    set.clear();
+    QCOMPARE(set.sampleCount(), 0);
+    compareValues(set, QList<qreal>() << 0 << 0 << 0 << 0 << 0);
+}
+
+void tst_QBoxSet::seriesStatistics()
+{
+    // Enough samples for the series to compute the statistics of the sets in parallel
+    const int count = 60000;
+    QList<qreal> samples;
+    samples.reserve(count);
+    for (int i = 0; i < count; i++)
+        samples << (qint64(i) * 7919) % count;
+
+    QBoxPlotSeries *series = new QBoxPlotSeries();
+    QBoxSet *set1 = new QBoxSet();
+    QBoxSet *set2 = new QBoxSet();
+    set1->setSamples(samples);
+    set2->setSamples(samples);
+    series->append(set1);
+    series->append(set2);
+
+    QChartView view(new QChart());
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    // The samples are a permutation of 0 ... count - 1
+    const QList<qreal> expected = QList<qreal>() << 0 << 14999.5 << 29999.5 << 44999.5 << 59999;
+    compareValues(*set1, expected);
+    compareValues(*set2, expected);
+
+    // Computing a single set gives the same result
+    QBoxSet set;
+    set.setSamples(samples);
+    compareValues(set, expected);
+}
+
+QTEST_MAIN(tst_QBoxSet)
+
+#include "tst_qboxset.moc"
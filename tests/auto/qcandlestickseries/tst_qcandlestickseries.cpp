@@ -30,6 +30,7 @@
 #include <QtCharts/QCandlestickSeries>
 #include <QtCharts/QCandlestickSet>
 #include <QtCharts/QChartView>
+#include <QtCharts/QValueAxis>
 #include <QtTest/QtTest>
 #include "tst_definitions.h"
 
@@ -54,11 +55,13 @@ private Q_SLOTS:
     void remove();
     void appendList();
     void removeList();
+    void appendListToChart();
     void insert();
     void take();
     void clear();
     void sets();
     void count();
+    void columnData();
     void type();
     void maximumColumnWidth_data();
     void maximumColumnWidth();
@@ -259,6 +262,36 @@ void tst_QCandlestickSeries::removeList()
     QCOMPARE(m_series->count(), 0);
 }
 
+void tst_QCandlestickSeries::appendListToChart()
+{
+    QCandlestickSeries *series = new QCandlestickSeries();
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    view.chart()->addSeries(series);
+    view.chart()->createDefaultAxes();
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    // Append sets with unordered timestamps in one go
+    QList<QCandlestickSet *> sets;
+    for (int i = 0; i < 1000; ++i)
+        sets.append(new QCandlestickSet((i * 7919 % 1000) * 10.0));
+    QVERIFY(series->append(sets));
+    QCOMPARE(series->sets(), sets);
+
+    // Remove every other set, the order of the remaining sets is kept
+    QList<QCandlestickSet *> removed;
+    QList<QCandlestickSet *> remaining;
+    for (int i = 0; i < sets.count(); ++i)
+        (i % 2 ? remaining : removed).append(sets.at(i));
+    QVERIFY(series->remove(removed));
+    QCOMPARE(series->sets(), remaining);
+
+    // Removing the same sets again fails
+    QVERIFY(!series->remove(removed));
+    QCOMPARE(series->count(), remaining.count());
+}
+
 void tst_QCandlestickSeries::insert()
 {
     QCOMPARE(m_series->count(), 0);
@@ -332,6 +365,99 @@ void tst_QCandlestickSeries::count()
     QCOMPARE(m_series->count(), m_series->sets().count());
 }
 
+void tst_QCandlestickSeries::columnData()
+{
+    QSignalSpy spy(m_series, SIGNAL(columnDataChanged()));
+    QCOMPARE(m_series->columnDataCount(), 0);
+
+    // Arrays of different sizes are rejected
+    QVector<qreal> timestamps = { 3000.0, 1000.0, 2000.0 };
+    QVector<qreal> open = { 3.0, 1.0, 2.0 };
+    QVector<qreal> high = { 4.0, 2.0, 3.0 };
+    QVector<qreal> low = { 2.0, 0.0, 1.0 };
+    QVector<qreal> close = { 3.5, 1.5 };
+    QVERIFY(!m_series->setColumnData(timestamps, open, high, low, close));
+    QCOMPARE(m_series->columnDataCount(), 0);
+    QCOMPARE(spy.count(), 0);
+
+    // Unsorted bars are accepted
+    close.append(2.5);
+    QVERIFY(m_series->setColumnData(timestamps, open, high, low, close));
+    QCOMPARE(m_series->columnDataCount(), 3);
+    QCOMPARE(spy.count(), 1);
+
+    m_series->appendColumnData(4000.0, 4.0, 5.0, 3.0, 4.5);
+    m_series->appendColumnData(500.0, 1.0, 1.5, 0.5, 1.0);
+    QCOMPARE(m_series->columnDataCount(), 5);
+    QCOMPARE(spy.count(), 3);
+
+    // Column data does not create candlestick items
+    QCOMPARE(m_series->count(), 0);
+
+    m_series->clearColumnData();
+    QCOMPARE(m_series->columnDataCount(), 0);
+    QCOMPARE(spy.count(), 4);
+
+    // The domain covers the column data, also when there are more bars than pixels
+    QCandlestickSeries *series = new QCandlestickSeries();
+    const int count = 100000;
+    timestamps.resize(count);
+    open.resize(count);
+    high.resize(count);
+    low.resize(count);
+    close.resize(count);
+    for (int i = 0; i < count; ++i) {
+        timestamps[i] = i * 60000.0;
+        open[i] = 10.0 + (i % 7);
+        close[i] = 10.0 + (i % 5);
+        high[i] = 20.0 + (i % 3);
+        low[i] = 5.0 - (i % 2);
+    }
+    QVERIFY(series->setColumnData(timestamps, open, high, low, close));
+
+    QChartView view(new QChart());
+    view.resize(400, 300);
+    QValueAxis *axisX = new QValueAxis();
+    QValueAxis *axisY = new QValueAxis();
+    view.chart()->addAxis(axisX, Qt::AlignBottom);
+    view.chart()->addAxis(axisY, Qt::AlignLeft);
+    view.chart()->addSeries(series);
+    series->attachAxis(axisX);
+    series->attachAxis(axisY);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    QCOMPARE(axisY->min(), 4.0);
+    QCOMPARE(axisY->max(), 22.0);
+    QVERIFY(axisX->min() < 0.0);
+    QVERIFY(axisX->max() > timestamps.last());
+
+    // Zooming in shows a window of a few bars, and resetting the zoom shows all of them again
+    const qreal fullMin = axisX->min();
+    const qreal fullMax = axisX->max();
+    view.chart()->zoomIn(QRectF(view.chart()->plotArea().center(), QSizeF(10.0, 10.0)));
+    QTest::qWait(10);
+    QVERIFY(axisX->min() > timestamps.first());
+    QVERIFY(axisX->max() < timestamps.last());
+    QVERIFY((axisX->max() - axisX->min()) * 10.0 < fullMax - fullMin);
+    view.chart()->zoomReset();
+    QTest::qWait(10);
+    QCOMPARE(axisX->min(), fullMin);
+    QCOMPARE(axisX->max(), fullMax);
+
+    // Bars appended in order and out of order, both zoomed out and in
+    for (int i = count; i < count + 100; ++i)
+        series->appendColumnData(i * 60000.0, 10.0, 20.0, 5.0, 15.0);
+    QTest::qWait(10);
+    series->appendColumnData(30000.0, 10.0, 20.0, 5.0, 15.0);
+    QTest::qWait(10);
+    const qreal zoomedOutRange = axisX->max() - axisX->min();
+    view.chart()->zoom(1000.0);
+    QTest::qWait(10);
+    QCOMPARE(series->columnDataCount(), count + 101);
+    QVERIFY((axisX->max() - axisX->min()) * 100.0 < zoomedOutRange);
+}
+
 void tst_QCandlestickSeries::type()
 {
     QCOMPARE(m_series->type(), QAbstractSeries::SeriesTypeCandlestick);
@@ -1,4 +1,5 @@
 !include( ../auto.pri ) {
     error( "Couldn't find the auto.pri file!" )
 }
+QT += charts-private
 SOURCES += tst_qchart.cpp
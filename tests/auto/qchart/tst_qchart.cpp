@@ -41,6 +41,9 @@
 #include <QtCharts/QValueAxis>
 #include <QtCharts/QBarCategoryAxis>
 #include <QtCharts/QDateTimeAxis>
+#include <private/xychart_p.h>
+#include <private/abstractdomain_p.h>
+#include <private/xyseriescolumns_p.h>
 #include "tst_definitions.h"
 
 QT_CHARTS_USE_NAMESPACE
@@ -74,6 +77,8 @@ private slots:
     void animationDuration();
     void animationCurve_data();
     void animationCurve();
+    void animationPointLimit_data();
+    void animationPointLimit();
     void axisX_data();
     void axisX();
     void axisY_data();
@@ -119,6 +124,7 @@ private slots:
     void zoomOut_data();
     void zoomOut();
     void zoomReset();
+    void zoomManySeries();
     void createDefaultAxesForLineSeries_data();
     void createDefaultAxesForLineSeries();
     void axisPolarOrientation();
@@ -180,6 +186,7 @@ void tst_QChart::qchart()
     QCOMPARE(m_chart->animationOptions(), QChart::NoAnimation);
     QCOMPARE(m_chart->animationDuration(), 1000);
     QCOMPARE(m_chart->animationEasingCurve(), QEasingCurve(QEasingCurve::OutQuart));
+    QCOMPARE(m_chart->animationPointLimit(), -1);
     QVERIFY(!m_chart->axisX());
     QVERIFY(!m_chart->axisY());
     QVERIFY(m_chart->backgroundBrush()!=QBrush());
@@ -302,6 +309,75 @@ void tst_QChart::animationCurve()
     QCOMPARE(m_chart->animationEasingCurve(), animationCurve);
 }
 
+void tst_QChart::animationPointLimit_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("animated");
+    QTest::newRow("below limit") << 5 << true;
+    QTest::newRow("at limit") << 10 << true;
+    QTest::newRow("above limit") << 11 << false;
+    QTest::newRow("far above limit") << 1000 << false;
+}
+
+static XYChart *findXYChart(QChart *chart)
+{
+    foreach (QGraphicsItem *item, chart->scene()->items()) {
+        XYChart *xyChart = qobject_cast<XYChart *>(item->toGraphicsObject());
+        if (xyChart)
+            return xyChart;
+    }
+    return 0;
+}
+
+void tst_QChart::animationPointLimit()
+{
+    QFETCH(int, count);
+    QFETCH(bool, animated);
+
+    m_chart->setAnimationPointLimit(10);
+    QCOMPARE(m_chart->animationPointLimit(), 10);
+
+    QLineSeries *series = new QLineSeries(this);
+    for (int i = 0; i < count; i++)
+        series->append(i, i % 2);
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    // Long enough for the animation to still run when it is checked
+    m_chart->setAnimationDuration(10000);
+    m_chart->setAnimationOptions(QChart::SeriesAnimations);
+    XYChart *item = findXYChart(m_chart);
+    QVERIFY(item);
+    QVERIFY(item->animation());
+    QApplication::processEvents();
+    QCOMPARE(item->animation()->state(), QAbstractAnimation::Stopped);
+
+    QList<QPointF> points;
+    for (int i = 0; i < count; i++)
+        points.append(QPointF(i, (i + 1) % 2));
+    series->replace(points);
+
+    // Animations are started from the event loop.
+    if (animated) {
+        QTRY_COMPARE(item->animation()->state(), QAbstractAnimation::Running);
+    } else {
+        QApplication::processEvents();
+        QCOMPARE(item->animation()->state(), QAbstractAnimation::Stopped);
+
+        // The geometry is updated at once.
+        const QVector<QPointF> geometryPoints = item->geometryPoints();
+        QCOMPARE(geometryPoints.count(), count);
+        for (int i = 0; i < count; i++) {
+            bool ok;
+            const QPointF expected = item->domain()->calculateGeometryPoint(points.at(i), ok);
+            QVERIFY(ok);
+            QCOMPARE(geometryPoints.at(i), expected);
+        }
+    }
+}
+
 void tst_QChart::axisX_data()
 {
 
@@ -978,6 +1054,71 @@ void tst_QChart::zoomReset()
 
 }
 
+// Compares the geometry points of all the xy series in the chart with the ones calculated
+// serially from the series points in view.
+static void compareSerialGeometry(QChart *chart, int expectedItemCount)
+{
+    int itemCount = 0;
+    foreach (QGraphicsItem *graphicsItem, chart->scene()->items()) {
+        XYChart *item = qobject_cast<XYChart *>(graphicsItem->toGraphicsObject());
+        // Items of removed series are hidden until they are deleted
+        if (!item || !item->isVisible())
+            continue;
+        itemCount++;
+        int offset;
+        const QVector<QPointF> points = item->geometryColumns(offset).toPoints();
+        QCOMPARE(item->geometryPointsOffset(), offset);
+        const QVector<QPointF> expected = item->domain()->calculateGeometryPoints(points);
+        const QVector<QPointF> geometryPoints = item->geometryPoints();
+        QCOMPARE(geometryPoints.size(), expected.size());
+        for (int i = 0; i < expected.size(); i++) {
+            QVERIFY(geometryPoints.at(i).x() == expected.at(i).x());
+            QVERIFY(geometryPoints.at(i).y() == expected.at(i).y());
+        }
+    }
+    QCOMPARE(itemCount, expectedItemCount);
+}
+
+void tst_QChart::zoomManySeries()
+{
+    // Enough points for the geometry of the series to be calculated in parallel, with one
+    // series that is above the threshold on its own.
+    for (int i = 0; i < 8; i++) {
+        QLineSeries *series = new QLineSeries(this);
+        QVector<QPointF> points;
+        const int count = i == 0 ? 150000 : 20000;
+        for (int j = 0; j < count; j++)
+            points << QPointF(j, j % 100 + i * 100);
+        series->appendPoints(points);
+        m_chart->addSeries(series);
+    }
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    QValueAxis *axisX = qobject_cast<QValueAxis *>(m_chart->axisX());
+    QVERIFY(axisX != 0);
+    const qreal minX = axisX->min();
+    const qreal maxX = axisX->max();
+
+    m_chart->zoomIn();
+    QVERIFY(m_chart->isZoomed());
+    compareSerialGeometry(m_chart, 8);
+    m_chart->scroll(10, 0);
+    compareSerialGeometry(m_chart, 8);
+    m_chart->zoomReset();
+    QVERIFY(!m_chart->isZoomed());
+    QCOMPARE(axisX->min(), minX);
+    QCOMPARE(axisX->max(), maxX);
+    compareSerialGeometry(m_chart, 8);
+
+    // Removing a series while others are still in the chart must not leave stale items behind
+    m_chart->removeSeries(m_chart->series().first());
+    m_chart->scroll(0, 10);
+    QCOMPARE(m_chart->series().count(), 7);
+    compareSerialGeometry(m_chart, 7);
+}
+
 void tst_QChart::createDefaultAxesForLineSeries_data()
 {
     QTest::addColumn<qreal>("series1minX");
@@ -29,6 +29,12 @@
 
 #include "../qxyseries/tst_qxyseries.h"
 #include <QtCharts/QLineSeries>
+#include <QtCharts/QPolarChart>
+#include <QtCharts/QValueAxis>
+#include <private/xychart_p.h>
+#include <private/abstractdomain_p.h>
+#include <private/linechartitem_p.h>
+#include <private/polardomain_p.h>
 
 Q_DECLARE_METATYPE(QList<QPointF>)
 Q_DECLARE_METATYPE(QVector<QPointF>)
@@ -49,12 +55,19 @@ private slots:
     void releasedSignal();
     void doubleClickedSignal();
     void insert();
+    void decimationMode();
+    void culling();
+    void cullingAnimated();
+    void shape();
+    void polarPath();
+    void appendGeometry();
 protected:
     void pointsVisible_data();
 };
 
 void tst_QLineSeries::initTestCase()
 {
+    qRegisterMetaType<QLineSeries::DecimationMode>("QLineSeries::DecimationMode");
 }
 
 void tst_QLineSeries::cleanupTestCase()
@@ -93,6 +106,7 @@ void tst_QLineSeries::qlineseries()
     QCOMPARE(series.pointLabelsVisible(), false);
     QCOMPARE(series.pointLabelsFormat(), QLatin1String("@xPoint, @yPoint"));
     QCOMPARE(series.pointLabelsClipping(), true);
+    QCOMPARE(series.decimationMode(), QLineSeries::NoDecimation);
 
     series.append(QList<QPointF>());
     series.append(0.0,0.0);
@@ -237,7 +251,314 @@ void tst_QLineSeries::doubleClickedSignal()
     QCOMPARE(qRound(signalPoint.y()), qRound(linePoint.y()));
 }
 
+static XYChart *findXYChart(QChart *chart)
+{
+    foreach (QGraphicsItem *item, chart->scene()->items()) {
+        XYChart *xyChart = qobject_cast<XYChart *>(item->toGraphicsObject());
+        if (xyChart)
+            return xyChart;
+    }
+    return 0;
+}
+
+void tst_QLineSeries::decimationMode()
+{
+    QLineSeries *lineSeries = new QLineSeries();
+    QSignalSpy decimationSpy(lineSeries, SIGNAL(decimationModeChanged(QLineSeries::DecimationMode)));
+
+    lineSeries->setDecimationMode(QLineSeries::MinMaxDecimation);
+    QCOMPARE(lineSeries->decimationMode(), QLineSeries::MinMaxDecimation);
+    QCOMPARE(decimationSpy.count(), 1);
+    lineSeries->setDecimationMode(QLineSeries::MinMaxDecimation);
+    QCOMPARE(decimationSpy.count(), 1);
+
+    for (int i = 0; i < 100000; i++)
+        lineSeries->append(i, qSin(i / 100.0));
+
+    m_chart->setAnimationOptions(QChart::NoAnimation);
+    m_chart->addSeries(lineSeries);
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    LineChartItem *item = qobject_cast<LineChartItem *>(findXYChart(m_chart));
+    QVERIFY(item);
+    const QVector<QPointF> points = item->geometryPoints();
+    QCOMPARE(points.count(), 100000);
+
+    // At most four points are kept per pixel column: the first, the lowest, the highest,
+    // and the last one.
+    const QVector<QPointF> &decimated = item->linePoints();
+    const qreal width = item->domain()->size().width();
+    QVERIFY(decimated.count() < points.count());
+    QVERIFY(decimated.count() <= 4 * (int(width) + 2));
+    QCOMPARE(decimated.first(), points.first());
+    QCOMPARE(decimated.last(), points.last());
+
+    QHash<int, QPair<qreal, qreal> > columnRanges;
+    foreach (const QPointF &point, points) {
+        const int column = qFloor(point.x());
+        QHash<int, QPair<qreal, qreal> >::iterator range = columnRanges.find(column);
+        if (range == columnRanges.end()) {
+            columnRanges.insert(column, qMakePair(point.y(), point.y()));
+        } else {
+            range->first = qMin(range->first, point.y());
+            range->second = qMax(range->second, point.y());
+        }
+    }
+    QHash<int, QPair<qreal, qreal> > decimatedRanges;
+    for (int i = 0; i < decimated.count(); i++) {
+        const QPointF &point = decimated.at(i);
+        // The points stay in their original order.
+        if (i > 0)
+            QVERIFY(point.x() >= decimated.at(i - 1).x());
+        const int column = qFloor(point.x());
+        QHash<int, QPair<qreal, qreal> >::iterator range = decimatedRanges.find(column);
+        if (range == decimatedRanges.end()) {
+            decimatedRanges.insert(column, qMakePair(point.y(), point.y()));
+        } else {
+            range->first = qMin(range->first, point.y());
+            range->second = qMax(range->second, point.y());
+        }
+    }
+    QCOMPARE(decimatedRanges, columnRanges);
+
+    lineSeries->setDecimationMode(QLineSeries::NoDecimation);
+    QCOMPARE(lineSeries->decimationMode(), QLineSeries::NoDecimation);
+    QCOMPARE(decimationSpy.count(), 2);
+    QCOMPARE(lineSeries->count(), 100000);
+    QTRY_COMPARE(item->linePoints(), item->geometryPoints());
+}
+
+void tst_QLineSeries::culling()
+{
+    QLineSeries *lineSeries = new QLineSeries();
+    for (int i = 0; i < 10000; i++)
+        lineSeries->append(i, qSin(i / 100.0));
+
+    m_chart->setAnimationOptions(QChart::NoAnimation);
+    m_chart->addSeries(lineSeries);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    XYChart *item = findXYChart(m_chart);
+    QVERIFY(item);
+    QCOMPARE(item->geometryPoints().count(), 10000);
+    QCOMPARE(item->geometryPointsOffset(), 0);
+
+    // Only the points in view and their neighbors are mapped
+    m_chart->axisX(lineSeries)->setRange(100.5, 110.5);
+    QApplication::processEvents();
+    QCOMPARE(item->geometryPointsOffset(), 100);
+    QCOMPARE(item->geometryPoints().count(), 12);
+    bool ok;
+    QCOMPARE(item->geometryPoints().first(),
+             item->domain()->calculateGeometryPoint(lineSeries->at(100), ok));
+
+    lineSeries->replace(105, QPointF(105, 2));
+    QApplication::processEvents();
+    QCOMPARE(item->geometryPoints().at(5),
+             item->domain()->calculateGeometryPoint(QPointF(105, 2), ok));
+
+    // Points that are not sorted by x can't be culled
+    lineSeries->append(0, 0);
+    QApplication::processEvents();
+    QCOMPARE(item->geometryPointsOffset(), 0);
+    QCOMPARE(item->geometryPoints().count(), 10001);
+}
+
+void tst_QLineSeries::cullingAnimated()
+{
+    QLineSeries *lineSeries = new QLineSeries();
+    for (int i = 0; i < 1000; i++)
+        lineSeries->append(i, qSin(i / 100.0));
+
+    m_chart->setAnimationOptions(QChart::SeriesAnimations);
+    m_chart->addSeries(lineSeries);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    XYChart *item = findXYChart(m_chart);
+    QVERIFY(item);
+    QVERIFY(item->animation());
+    QTRY_COMPARE(item->animation()->state(), QAbstractAnimation::Stopped);
+
+    // Points are culled while no animation is running. The complete and the culled geometry
+    // points can't be interpolated, so the change is applied without an animation.
+    m_chart->axisX(lineSeries)->setRange(100.5, 110.5);
+    QApplication::processEvents();
+    QCOMPARE(item->geometryPointsOffset(), 100);
+    QCOMPARE(item->geometryPoints().count(), 12);
+    QCOMPARE(item->animation()->state(), QAbstractAnimation::Stopped);
+
+    // Changes within the same range of points are animated
+    lineSeries->replace(105, QPointF(105, 0.5));
+    QTRY_COMPARE(item->animation()->state(), QAbstractAnimation::Running);
+    QCOMPARE(item->geometryPointsOffset(), 100);
+    QCOMPARE(item->geometryPoints().count(), 12);
+    QTRY_COMPARE(item->animation()->state(), QAbstractAnimation::Stopped);
+    bool ok;
+    QCOMPARE(item->geometryPoints().at(5),
+             item->domain()->calculateGeometryPoint(QPointF(105, 0.5), ok));
+
+    // Back to the complete range
+    m_chart->axisX(lineSeries)->setRange(0, 999);
+    QApplication::processEvents();
+    QCOMPARE(item->geometryPointsOffset(), 0);
+    QCOMPARE(item->geometryPoints().count(), 1000);
+}
+
+void tst_QLineSeries::shape()
+{
+    QLineSeries *lineSeries = new QLineSeries();
+    lineSeries->append(0, 0);
+    lineSeries->append(10, 10);
+
+    m_chart->setAnimationOptions(QChart::NoAnimation);
+    m_chart->addSeries(lineSeries);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    XYChart *item = findXYChart(m_chart);
+    QVERIFY(item);
+    QVERIFY(!item->boundingRect().isEmpty());
+
+    // The stroke for hit testing is created on demand, whether or not anything is connected
+    // to the mouse signals of the series.
+    QPainterPath shape = item->shape();
+    QVERIFY(!shape.isEmpty());
+    QVERIFY(item->boundingRect().contains(shape.boundingRect()));
+    bool ok;
+    QVERIFY(shape.contains(item->domain()->calculateGeometryPoint(QPointF(5, 5), ok)));
+    QVERIFY(!shape.contains(item->domain()->calculateGeometryPoint(QPointF(8, 2), ok)));
+
+    // The stroke follows geometry changes
+    lineSeries->replace(1, QPointF(10, 0));
+    shape = item->shape();
+    QVERIFY(item->boundingRect().contains(shape.boundingRect()));
+    QVERIFY(shape.contains(item->domain()->calculateGeometryPoint(QPointF(8, 0), ok)));
+    QVERIFY(!shape.contains(item->domain()->calculateGeometryPoint(QPointF(5, 5), ok)));
+}
+
+void tst_QLineSeries::polarPath()
+{
+    // With an angular range of 169, scaling by 360 / 169 would put the last point
+    // slightly past 360 degrees.
+    QLineSeries *lineSeries = new QLineSeries();
+    const qreal xValues[] = { 0, 13, 26, 52, 100, 150, 169, 10, 20, 169, 168, 0, 84.5, 85 };
+    for (int i = 0; i < int(sizeof(xValues) / sizeof(xValues[0])); i++)
+        lineSeries->append(xValues[i], 2 + (i * 7) % 8);
+
+    QPolarChart *chart = new QPolarChart();
+    QChartView view(chart);
+    view.resize(400, 400);
+    QValueAxis *angularAxis = new QValueAxis();
+    angularAxis->setRange(0, 169);
+    QValueAxis *radialAxis = new QValueAxis();
+    radialAxis->setRange(0, 10);
+    chart->addAxis(angularAxis, QPolarChart::PolarOrientationAngular);
+    chart->addAxis(radialAxis, QPolarChart::PolarOrientationRadial);
+    chart->addSeries(lineSeries);
+    lineSeries->attachAxis(angularAxis);
+    lineSeries->attachAxis(radialAxis);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    LineChartItem *item = qobject_cast<LineChartItem *>(findXYChart(chart));
+    QVERIFY(item);
+    const PolarDomain *domain = qobject_cast<const PolarDomain *>(item->domain());
+    QVERIFY(domain);
+
+    // The full path as it was built point by point with the angle of each point: a segment
+    // between points more than 180 degrees apart goes through the center.
+    const QVector<QPointF> points = item->geometryPoints();
+    QCOMPARE(points.count(), lineSeries->count());
+    const qreal radius = domain->size().height() / 2.0;
+    const QPointF center(radius, radius);
+    QPainterPath expected;
+    expected.moveTo(points.at(0));
+    bool ok;
+    qreal previousAngle = domain->toAngularCoordinate(lineSeries->at(0).x(), ok);
+    for (int i = 1; i < points.count(); i++) {
+        const qreal angle = domain->toAngularCoordinate(lineSeries->at(i).x(), ok);
+        if (qAbs(angle - previousAngle) > 180.0)
+            expected.lineTo(center);
+        expected.lineTo(points.at(i));
+        previousAngle = angle;
+    }
+
+    const QPainterPath path = item->path();
+    QCOMPARE(path.elementCount(), expected.elementCount());
+    for (int i = 0; i < path.elementCount(); i++) {
+        const QPainterPath::Element element = path.elementAt(i);
+        const QPainterPath::Element expectedElement = expected.elementAt(i);
+        QCOMPARE(element.type, expectedElement.type);
+        QVERIFY(element.x == expectedElement.x);
+        QVERIFY(element.y == expectedElement.y);
+    }
+}
+
+void tst_QLineSeries::appendGeometry()
+{
+    QLineSeries *lineSeries = new QLineSeries();
+    for (int i = 0; i < 100; i++)
+        lineSeries->append(i, qSin(i / 10.0));
+
+    m_chart->setAnimationOptions(QChart::NoAnimation);
+    m_chart->addSeries(lineSeries);
+    m_chart->createDefaultAxes();
+    m_chart->axisX(lineSeries)->setRange(0, 300);
+    m_chart->axisY(lineSeries)->setRange(-2, 2);
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+
+    LineChartItem *item = qobject_cast<LineChartItem *>(findXYChart(m_chart));
+    QVERIFY(item);
+    const QRectF initialRect = item->boundingRect();
+
+    // Single points and blocks of points are appended to the line.
+    for (int step = 0; step < 20; step++) {
+        if (step % 2) {
+            QVector<QPointF> points;
+            for (int i = 0; i < 7; i++) {
+                const int x = lineSeries->count() + i;
+                points.append(QPointF(x, qSin(x / 10.0) * 1.5));
+            }
+            lineSeries->appendPoints(points);
+        } else {
+            const int x = lineSeries->count();
+            lineSeries->append(x, qSin(x / 10.0) * 1.5);
+        }
+
+        const QVector<QPointF> points = item->geometryPoints();
+        QCOMPARE(points.count(), lineSeries->count());
+        for (int i = 0; i < points.count(); i++) {
+            bool ok;
+            QCOMPARE(points.at(i), item->domain()->calculateGeometryPoint(lineSeries->at(i), ok));
+        }
+        QCOMPARE(item->linePoints(), points);
+
+        QPainterPath expected;
+        expected.moveTo(points.at(0));
+        for (int i = 1; i < points.count(); i++)
+            expected.lineTo(points.at(i));
+        const QPainterPath path = item->path();
+        QCOMPARE(path.elementCount(), expected.elementCount());
+        for (int i = 0; i < path.elementCount(); i++) {
+            QCOMPARE(path.elementAt(i).type, expected.elementAt(i).type);
+            QCOMPARE(QPointF(path.elementAt(i)), QPointF(expected.elementAt(i)));
+        }
+        QVERIFY(item->boundingRect().contains(path.controlPointRect()));
+    }
+
+    // The bounding rect grows with the appended points, which reach further than the first ones.
+    QVERIFY(item->boundingRect().contains(initialRect));
+    QVERIFY(item->boundingRect().height() > initialRect.height());
+    QVERIFY(item->boundingRect().width() > initialRect.width());
+}
+
 QTEST_MAIN(tst_QLineSeries)
 
 #include "tst_qlineseries.moc"
-
@@ -49,6 +49,7 @@ private slots:
     void pressedSignal();
     void releasedSignal();
     void doubleClickedSignal();
+    void batchedClickedSignal();
 
 protected:
     void pointsVisible_data();
@@ -236,6 +237,43 @@ void tst_QScatterSeries::doubleClickedSignal()
     QCOMPARE(qRound(signalPoint.y()), qRound(scatterPoint.y()));
 }
 
+void tst_QScatterSeries::batchedClickedSignal()
+{
+    SKIP_IF_CANNOT_TEST_MOUSE_EVENTS();
+
+    // Enough points for the series to be drawn without per-marker graphics items.
+    QPointF scatterPoint(4, 12);
+    QScatterSeries *scatterSeries = new QScatterSeries();
+    for (int i = 0; i < 2000; i++)
+        scatterSeries->append(QPointF(i / 200.0, 1));
+    scatterSeries->append(scatterPoint);
+
+    QChartView view;
+    view.resize(200, 200);
+    view.chart()->legend()->setVisible(false);
+    view.chart()->addSeries(scatterSeries);
+    view.show();
+    QTest::qWaitForWindowShown(&view);
+
+    QSignalSpy clickedSpy(scatterSeries, SIGNAL(clicked(QPointF)));
+    QSignalSpy pressedSpy(scatterSeries, SIGNAL(pressed(QPointF)));
+
+    QPointF checkPoint = view.chart()->mapToPosition(scatterPoint);
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+
+    QCOMPARE(pressedSpy.count(), 1);
+    QCOMPARE(clickedSpy.count(), 1);
+    QPointF signalPoint = qvariant_cast<QPointF>(clickedSpy.takeFirst().at(0));
+    QCOMPARE(signalPoint, scatterPoint);
+
+    // Clicking the empty plot area does not hit any marker.
+    checkPoint = view.chart()->mapToPosition(QPointF(8, 8));
+    QTest::mouseClick(view.viewport(), Qt::LeftButton, 0, checkPoint.toPoint());
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 1000);
+    QCOMPARE(clickedSpy.count(), 0);
+}
+
 QTEST_MAIN(tst_QScatterSeries)
 
 #include "tst_qscatterseries.moc"
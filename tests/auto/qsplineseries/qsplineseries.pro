@@ -1,5 +1,6 @@
 !include( ../auto.pri ) {
     error( "Couldn't find the auto.pri file!" )
 }
+QT += charts-private
 HEADERS += ../qxyseries/tst_qxyseries.h
 SOURCES += tst_qsplineseries.cpp ../qxyseries/tst_qxyseries.cpp
@@ -29,6 +29,7 @@
 
 #include "../qxyseries/tst_qxyseries.h"
 #include <QtCharts/QSplineSeries>
+#include <private/splinecontrolpoints_p.h>
 
 Q_DECLARE_METATYPE(QList<QPointF>)
 Q_DECLARE_METATYPE(QVector<QPointF>)
@@ -48,6 +49,7 @@ private slots:
     void pressedSignal();
     void releasedSignal();
     void doubleClickedSignal();
+    void controlPoints();
 protected:
     void pointsVisible_data();
 };
@@ -206,6 +208,49 @@ void tst_QSplineSeries::doubleClickedSignal()
     QCOMPARE(qRound(signalPoint.x()), qRound(splinePoint.x()));
     QCOMPARE(qRound(signalPoint.y()), qRound(splinePoint.y()));
 }
+void tst_QSplineSeries::controlPoints()
+{
+    // Control points solved again only around the changes match a full solve.
+    QVector<QPointF> points;
+    SplineControlPoints cache;
+    for (int step = 0; step < 400; step++) {
+        if (step % 4 != 3) {
+            const int first = points.count();
+            for (int i = 0; i < 1 + step % 7; i++)
+                points.append(QPointF(first + i, qSin(first + i) * 100 + step % 13));
+            cache.pointsAppended(first, points.count());
+        } else {
+            const int index = (step * 37) % points.count();
+            const int count = qMin(3, points.count() - index);
+            for (int i = index; i < index + count; i++)
+                points[i].setY(points[i].y() - step);
+            cache.pointsUpdated(index, count);
+        }
+        if (step % 3 == 0)
+            continue;
+        const QVector<QPointF> cached = cache.controlPoints(XYSeriesColumns(points));
+        const QVector<QPointF> expected = SplineControlPoints::calculate(points);
+        QCOMPARE(cached.count(), expected.count());
+        for (int i = 0; i < expected.count(); i++) {
+            QVERIFY(qAbs(cached.at(i).x() - expected.at(i).x()) < 1e-9);
+            QVERIFY(qAbs(cached.at(i).y() - expected.at(i).y()) < 1e-9);
+        }
+    }
+
+    // Streamed points extend the spline in a chart.
+    QSplineSeries *series = new QSplineSeries();
+    m_chart->addSeries(series);
+    m_chart->createDefaultAxes();
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+    for (int i = 0; i < 100; i++)
+        series->append(i * 0.01, qSin(i * 0.1));
+    QApplication::processEvents();
+    series->replace(50, QPointF(0.5, 2));
+    QApplication::processEvents();
+    QCOMPARE(series->count(), 100);
+}
+
 QTEST_MAIN(tst_QSplineSeries)
 
 #include "tst_qsplineseries.moc"
@@ -257,6 +257,90 @@ void tst_QXYSeries::append_chart_animation()
     append_chart();
 }
 
+void tst_QXYSeries::append_chart_streaming()
+{
+    m_chart->setAnimationOptions(QChart::AllAnimations);
+    m_view->show();
+    m_chart->addSeries(m_series);
+    QTest::qWaitForWindowShown(m_view);
+
+    // Points appended while the previous append is still animated are streamed.
+    QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+    for (int i = 0; i < 1000; i++)
+        m_series->append(i, i % 10);
+    QCOMPARE(addedSpy.count(), 1000);
+    QCOMPARE(m_series->count(), 1000);
+    QTest::qWait(100);
+
+    m_series->replace(0, QPointF(0, 5));
+    m_series->append(1000, 5);
+    QCOMPARE(m_series->count(), 1001);
+    QCOMPARE(m_series->at(1000), QPointF(1000, 5));
+}
+
+void tst_QXYSeries::append_vector_data()
+{
+    append_data();
+}
+
+void tst_QXYSeries::append_vector()
+{
+    QFETCH(QList<QPointF>, points);
+    QFETCH(QList<QPointF>, otherPoints);
+    m_chart->addSeries(m_series);
+    QSignalSpy addedSpy(m_series, SIGNAL(pointAdded(int)));
+    QSignalSpy bulkAddedSpy(m_series, SIGNAL(pointsAdded(int,int)));
+
+    m_series->appendPoints(points.toVector());
+    QCOMPARE(addedSpy.count(), 0);
+    TRY_COMPARE(bulkAddedSpy.count(), 1);
+    QList<QVariant> arguments = bulkAddedSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), 0);
+    QCOMPARE(arguments.at(1).toInt(), points.count());
+    QCOMPARE(m_series->points(), points);
+
+    QVector<qreal> x;
+    QVector<qreal> y;
+    foreach (const QPointF &point, otherPoints) {
+        x.append(point.x());
+        y.append(point.y());
+    }
+    m_series->append(x.constData(), y.constData(), x.count());
+    TRY_COMPARE(bulkAddedSpy.count(), 1);
+    arguments = bulkAddedSpy.takeFirst();
+    QCOMPARE(arguments.at(0).toInt(), points.count());
+    QCOMPARE(arguments.at(1).toInt(), otherPoints.count());
+    QCOMPARE(m_series->points(), points + otherPoints);
+
+    // Invalid values are ignored, and nothing is emitted for an empty append.
+    m_series->appendPoints(QVector<QPointF>() << QPointF(qQNaN(), 0));
+    QCOMPARE(bulkAddedSpy.count(), 0);
+    QCOMPARE(m_series->count(), points.count() + otherPoints.count());
+}
+
+void tst_QXYSeries::appendAndRemoveFirst()
+{
+    m_chart->addSeries(m_series);
+    for (int i = 0; i < 10; i++)
+        m_series->append(i, i);
+
+    QSignalSpy replacedSpy(m_series, SIGNAL(pointsReplaced()));
+    QSignalSpy removedSpy(m_series, SIGNAL(pointsRemoved(int,int)));
+
+    QVector<QPointF> points;
+    points << QPointF(10, 10) << QPointF(11, 11) << QPointF(12, 12);
+    m_series->appendAndRemoveFirst(points, 3);
+    QCOMPARE(replacedSpy.count(), 1);
+    QCOMPARE(removedSpy.count(), 0);
+    QCOMPARE(m_series->count(), 10);
+    QCOMPARE(m_series->at(0), QPointF(3, 3));
+    QCOMPARE(m_series->at(9), QPointF(12, 12));
+
+    m_series->appendAndRemoveFirst(points, 100);
+    QCOMPARE(replacedSpy.count(), 2);
+    QCOMPARE(m_series->pointsVector(), points);
+}
+
 void tst_QXYSeries::count_data()
 {
     QTest::addColumn<int>("count");
@@ -528,6 +612,180 @@ void tst_QXYSeries::replace_chart_animation()
     replace_chart();
 }
 
+void tst_QXYSeries::replace_columns()
+{
+    m_chart->addSeries(m_series);
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+    QSignalSpy pointsReplacedSpy(m_series, SIGNAL(pointsReplaced()));
+
+    QVector<double> x;
+    QVector<double> y;
+    for (int i = 0; i < 100; i++) {
+        x << i;
+        y << i * 0.5;
+    }
+    // The longer vector is truncated
+    y << 1000.0;
+    m_series->replace(x, y);
+    QCOMPARE(pointsReplacedSpy.count(), 1);
+    QCOMPARE(m_series->count(), 100);
+    QCOMPARE(m_series->at(10), QPointF(10, 5));
+    QCOMPARE(m_series->pointsVector().count(), 100);
+    QCOMPARE(m_series->pointsVector().last(), QPointF(99, 49.5));
+
+    QVector<float> xf;
+    QVector<float> yf;
+    for (int i = 0; i < 50; i++) {
+        xf << i;
+        yf << -i;
+    }
+    m_series->replace(xf, yf);
+    QCOMPARE(pointsReplacedSpy.count(), 2);
+    QCOMPARE(m_series->count(), 50);
+    QCOMPARE(m_series->at(49), QPointF(49, -49));
+    QApplication::processEvents();
+
+    // Modifying the series converts the columns back to points
+    m_series->append(50, -50);
+    QCOMPARE(m_series->count(), 51);
+    QCOMPARE(m_series->at(0), QPointF(0, 0));
+    QCOMPARE(m_series->at(50), QPointF(50, -50));
+    m_series->remove(0);
+    QCOMPARE(m_series->count(), 50);
+    QCOMPARE(m_series->at(0), QPointF(1, -1));
+
+    m_series->replace(x, y);
+    m_series->clear();
+    QCOMPARE(m_series->count(), 0);
+    QApplication::processEvents();
+}
+
+void tst_QXYSeries::externalData()
+{
+    m_chart->addSeries(m_series);
+    m_view->show();
+    QTest::qWaitForWindowShown(m_view);
+    QSignalSpy pointsReplacedSpy(m_series, SIGNAL(pointsReplaced()));
+    QSignalSpy pointsAddedSpy(m_series, SIGNAL(pointsAdded(int,int)));
+    QSignalSpy pointsChangedSpy(m_series, SIGNAL(pointsChanged(int,int)));
+
+    struct Sample {
+        double time;
+        float value;
+        float unused;
+    };
+    QVector<Sample> samples(100);
+    for (int i = 0; i < samples.count(); i++) {
+        samples[i].time = i;
+        samples[i].value = i * 2;
+    }
+
+    m_series->setExternalData(&samples[0].time, &samples[0].value, 50,
+                              sizeof(Sample), sizeof(Sample));
+    QCOMPARE(pointsReplacedSpy.count(), 1);
+    QCOMPARE(m_series->count(), 50);
+    QCOMPARE(m_series->at(10), QPointF(10, 20));
+    QApplication::processEvents();
+
+    // The buffer is read in place
+    samples[10].value = -1;
+    samples[11].value = -2;
+    m_series->updateExternalData(10, 2);
+    QCOMPARE(pointsChangedSpy.count(), 1);
+    QCOMPARE(pointsChangedSpy.at(0).at(0).toInt(), 10);
+    QCOMPARE(pointsChangedSpy.at(0).at(1).toInt(), 2);
+    QCOMPARE(m_series->at(10), QPointF(10, -1));
+    QCOMPARE(m_series->at(11), QPointF(11, -2));
+    QApplication::processEvents();
+
+    // Out of range updates are clamped
+    m_series->updateExternalData(45, 10);
+    QCOMPARE(pointsChangedSpy.count(), 2);
+    QCOMPARE(pointsChangedSpy.at(1).at(1).toInt(), 5);
+
+    // Growing the same buffer adds points
+    m_series->setExternalData(&samples[0].time, &samples[0].value, 100,
+                              sizeof(Sample), sizeof(Sample));
+    QCOMPARE(pointsReplacedSpy.count(), 1);
+    QCOMPARE(pointsAddedSpy.count(), 1);
+    QCOMPARE(pointsAddedSpy.at(0).at(0).toInt(), 50);
+    QCOMPARE(pointsAddedSpy.at(0).at(1).toInt(), 50);
+    QCOMPARE(m_series->count(), 100);
+    QApplication::processEvents();
+
+    // Modifying the series detaches it from the buffer
+    m_series->append(100, 200);
+    QCOMPARE(m_series->count(), 101);
+    samples[0].value = 1000;
+    QCOMPARE(m_series->at(0), QPointF(0, 0));
+    m_series->updateExternalData(0, 1);
+    QCOMPARE(pointsChangedSpy.count(), 2);
+}
+
+static bool bruteForceYRange(const QVector<QPointF> &points, qreal fromX, qreal toX,
+                             qreal &minY, qreal &maxY)
+{
+    bool found = false;
+    foreach (const QPointF &point, points) {
+        if (point.x() < fromX || point.x() > toX)
+            continue;
+        minY = found ? qMin(minY, point.y()) : point.y();
+        maxY = found ? qMax(maxY, point.y()) : point.y();
+        found = true;
+    }
+    return found;
+}
+
+void tst_QXYSeries::yRange()
+{
+    bool ok = true;
+    QCOMPARE(m_series->yRange(0, 100, &ok), qMakePair(qreal(0), qreal(0)));
+    QVERIFY(!ok);
+
+    // Appends that span several index blocks
+    for (int i = 0; i < 1000; i++)
+        m_series->append(i, qSin(i * 0.1) * i);
+    QVector<QPointF> points(100);
+    for (int i = 0; i < points.count(); i++)
+        points[i] = QPointF(1000 + i, -qreal(i));
+    m_series->appendPoints(points);
+
+    const qreal windows[][2] = { {0, 1100}, {10.5, 20.5}, {250, 800}, {255, 257},
+                                 {-10, 5}, {1050, 2000}, {2000, 3000}, {30, 20} };
+    for (int step = 0; step < 3; step++) {
+        if (step == 1) {
+            m_series->replace(500, QPointF(500, 1e6));
+            m_series->replace(501, QPointF(501, -1e6));
+        } else if (step == 2) {
+            // The x-values are no longer sorted
+            m_series->insert(10, QPointF(600, 5e6));
+            m_series->remove(900);
+        }
+        const QVector<QPointF> seriesPoints = m_series->pointsVector();
+        for (int i = 0; i < int(sizeof(windows) / sizeof(windows[0])); i++) {
+            const qreal fromX = windows[i][0];
+            const qreal toX = windows[i][1];
+            qreal expectedMinY = 0;
+            qreal expectedMaxY = 0;
+            const bool expected = bruteForceYRange(seriesPoints, fromX, toX,
+                                                   expectedMinY, expectedMaxY);
+            const QPair<qreal, qreal> range = m_series->yRange(fromX, toX, &ok);
+            QCOMPARE(ok, expected);
+            QCOMPARE(range.first, expectedMinY);
+            QCOMPARE(range.second, expectedMaxY);
+        }
+    }
+
+    // The index is used for the axis ranges as well
+    m_chart->addSeries(m_series);
+    m_chart->createDefaultAxes();
+    QValueAxis *axisY = qobject_cast<QValueAxis *>(m_chart->axisY(m_series));
+    QVERIFY(axisY);
+    QCOMPARE(axisY->max(), 5e6);
+    QCOMPARE(axisY->min(), -1e6);
+}
+
 void tst_QXYSeries::insert_data()
 {
     append_data();
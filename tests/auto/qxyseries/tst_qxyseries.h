@@ -33,6 +33,7 @@
 #include <QtTest/QtTest>
 #include <QtCharts/QXYSeries>
 #include <QtCharts/QChartView>
+#include <QtCharts/QValueAxis>
 #include <QtGui/QStandardItemModel>
 #include <tst_definitions.h>
 
@@ -69,6 +70,10 @@ private slots:
     void append_chart();
     void append_chart_animation_data();
     void append_chart_animation();
+    void append_chart_streaming();
+    void append_vector_data();
+    void append_vector();
+    void appendAndRemoveFirst();
     void chart_append_data();
     void chart_append();
     void count_raw_data();
@@ -91,6 +96,9 @@ private slots:
     void replace_chart();
     void replace_chart_animation_data();
     void replace_chart_animation();
+    void replace_columns();
+    void externalData();
+    void yRange();
     void insert_data();
     void insert();
     void changedSignals();
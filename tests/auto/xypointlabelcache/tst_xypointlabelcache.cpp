@@ -0,0 +1,201 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Charts module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 or (at your option) any later version
+** approved by the KDE Free Qt Foundation. The licenses are as published by
+** the Free Software Foundation and appearing in the file LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+#include <QtCharts/QChart>
+#include <private/chartpresenter_p.h>
+#include <private/xypointlabelcache_p.h>
+
+QT_CHARTS_USE_NAMESPACE
+
+class tst_XYPointLabelCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void label();
+    void pointChanged();
+    void formatChanged();
+    void fontChanged();
+    void localeChanged();
+    void collisionGrid();
+    void collisionGridAcrossCells();
+};
+
+void tst_XYPointLabelCache::label()
+{
+    QChart chart;
+    ChartPresenter presenter(&chart, QChart::ChartTypeCartesian);
+    QFont font;
+    QFontMetrics metrics(font);
+    XYPointLabelCache cache;
+    cache.setFormat(QStringLiteral("@xPoint, @yPoint"), font, &presenter);
+
+    cache.beginPaint();
+    int width = 0;
+    const QString &label = cache.label(0, QPointF(1.5, 2.0), metrics, &width);
+    QCOMPARE(label, QStringLiteral("1.5, 2"));
+    QCOMPARE(width, metrics.width(label));
+    const QChar *text = label.constData();
+
+    // An unchanged point reuses the cached string.
+    width = 0;
+    QCOMPARE(cache.label(0, QPointF(1.5, 2.0), metrics, &width).constData(), text);
+    QCOMPARE(width, metrics.width(label));
+    cache.endPaint();
+}
+
+void tst_XYPointLabelCache::pointChanged()
+{
+    QChart chart;
+    ChartPresenter presenter(&chart, QChart::ChartTypeCartesian);
+    QFont font;
+    QFontMetrics metrics(font);
+    XYPointLabelCache cache;
+    cache.setFormat(QStringLiteral("@yPoint"), font, &presenter);
+
+    int width;
+    cache.beginPaint();
+    QCOMPARE(cache.label(3, QPointF(0, 1), metrics, &width), QStringLiteral("1"));
+    QCOMPARE(cache.label(3, QPointF(0, 1000), metrics, &width), QStringLiteral("1000"));
+    QCOMPARE(width, metrics.width(QStringLiteral("1000")));
+    cache.endPaint();
+}
+
+void tst_XYPointLabelCache::formatChanged()
+{
+    QChart chart;
+    ChartPresenter presenter(&chart, QChart::ChartTypeCartesian);
+    QFont font;
+    QFontMetrics metrics(font);
+    XYPointLabelCache cache;
+    int width;
+
+    cache.setFormat(QStringLiteral("@xPoint"), font, &presenter);
+    cache.beginPaint();
+    QCOMPARE(cache.label(0, QPointF(1, 2), metrics, &width), QStringLiteral("1"));
+    cache.endPaint();
+
+    cache.setFormat(QStringLiteral("(@xPoint; @yPoint)"), font, &presenter);
+    cache.beginPaint();
+    const QString &label = cache.label(0, QPointF(1, 2), metrics, &width);
+    QCOMPARE(label, QStringLiteral("(1; 2)"));
+    QCOMPARE(width, metrics.width(label));
+    cache.endPaint();
+}
+
+void tst_XYPointLabelCache::fontChanged()
+{
+    QChart chart;
+    ChartPresenter presenter(&chart, QChart::ChartTypeCartesian);
+    QFont smallFont;
+    smallFont.setPixelSize(8);
+    QFont largeFont;
+    largeFont.setPixelSize(40);
+    QFontMetrics smallMetrics(smallFont);
+    QFontMetrics largeMetrics(largeFont);
+    const QString expected(QStringLiteral("12345"));
+    QVERIFY(smallMetrics.width(expected) != largeMetrics.width(expected));
+    XYPointLabelCache cache;
+    int width;
+
+    cache.setFormat(QStringLiteral("@yPoint"), smallFont, &presenter);
+    cache.beginPaint();
+    QCOMPARE(cache.label(0, QPointF(0, 12345), smallMetrics, &width), expected);
+    QCOMPARE(width, smallMetrics.width(expected));
+    cache.endPaint();
+
+    // The text is the same, but the width has to be measured again.
+    cache.setFormat(QStringLiteral("@yPoint"), largeFont, &presenter);
+    cache.beginPaint();
+    QCOMPARE(cache.label(0, QPointF(0, 12345), largeMetrics, &width), expected);
+    QCOMPARE(width, largeMetrics.width(expected));
+    cache.endPaint();
+}
+
+void tst_XYPointLabelCache::localeChanged()
+{
+    QChart chart;
+    ChartPresenter presenter(&chart, QChart::ChartTypeCartesian);
+    presenter.setLocale(QLocale(QLocale::German, QLocale::Germany));
+    QFont font;
+    QFontMetrics metrics(font);
+    XYPointLabelCache cache;
+    int width;
+
+    cache.setFormat(QStringLiteral("@xPoint"), font, &presenter);
+    cache.beginPaint();
+    QCOMPARE(cache.label(0, QPointF(0.5, 0), metrics, &width), QStringLiteral("0.5"));
+    cache.endPaint();
+
+    presenter.setLocalizeNumbers(true);
+    cache.setFormat(QStringLiteral("@xPoint"), font, &presenter);
+    cache.beginPaint();
+    QCOMPARE(cache.label(0, QPointF(0.5, 0), metrics, &width),
+             presenter.numberToString(0.5));
+    QCOMPARE(cache.label(0, QPointF(0.5, 0), metrics, &width), QStringLiteral("0,5"));
+    cache.endPaint();
+}
+
+void tst_XYPointLabelCache::collisionGrid()
+{
+    XYLabelCollisionGrid grid(40, 10);
+
+    QVERIFY(grid.insert(QRectF(0, 0, 30, 10)));
+    // Overlapping the first label
+    QVERIFY(!grid.insert(QRectF(20, 5, 30, 10)));
+    QVERIFY(!grid.insert(QRectF(10, 2, 5, 5)));
+    // Next to the first label
+    QVERIFY(grid.insert(QRectF(31, 0, 30, 10)));
+    QVERIFY(grid.insert(QRectF(0, 11, 30, 10)));
+    // Overlapping the second label only
+    QVERIFY(!grid.insert(QRectF(55, 0, 30, 10)));
+    // A skipped label does not block later labels.
+    QVERIFY(grid.insert(QRectF(62, 0, 30, 10)));
+    QVERIFY(grid.insert(QRectF(-100, -100, 30, 10)));
+    QVERIFY(!grid.insert(QRectF(-95, -95, 30, 10)));
+}
+
+void tst_XYPointLabelCache::collisionGridAcrossCells()
+{
+    // A label much larger than a cell collides with small labels in any cell it covers.
+    XYLabelCollisionGrid grid(10, 10);
+
+    QVERIFY(grid.insert(QRectF(0, 0, 100, 50)));
+    for (int x = 0; x < 100; x += 7) {
+        for (int y = 0; y < 50; y += 7)
+            QVERIFY(!grid.insert(QRectF(x + 1, y + 1, 2, 2)));
+    }
+    QVERIFY(grid.insert(QRectF(101, 0, 2, 2)));
+    QVERIFY(grid.insert(QRectF(0, 51, 2, 2)));
+    QVERIFY(!grid.insert(QRectF(-50, -50, 200, 200)));
+}
+
+QTEST_MAIN(tst_XYPointLabelCache)
+
+#include "tst_xypointlabelcache.moc"